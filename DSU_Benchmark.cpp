@@ -0,0 +1,129 @@
+// Microbenchmark : DisjointSetUnion (DSU_Template) vs the old fixed size, recursive find DSU
+// Usage : ./DSU_Benchmark [n]     (default n = 10^7)
+
+// Workloads
+// 1. random   - n random unions followed by n random finds
+// 2. sequential - _union(i, i+1) for all i, then find on every node. Union by size hangs every new node under
+//                the one root, so the tree stays at depth 1 : the cheap case, no path halving work
+// 3. binomial   - unions that build binomial trees (deepest trees union by size allows), then find on every node,
+//                 the case that exercises path halving
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "DSU_Template"
+
+// The previous DSU_Template, only the size is a parameter here so it can be benchmarked at large n
+class DisjointSetUnionRecursive{
+private:
+    vector<int>parent;
+public:
+    DisjointSetUnionRecursive(int n){
+        parent.resize(n,-1);
+    }
+
+    void _union(int x , int y){
+        int root1 = find(x);
+        int root2 = find(y);
+
+        if(root1==root2){
+            return;
+        }
+
+        else if(parent[root2] < parent[root1]){
+            parent[root2] += parent[root1];
+            parent[root1] = root2;
+        }
+        else{
+            parent[root1] += parent[root2];
+            parent[root2] = root1;
+        }
+    }
+
+    int find(int x){
+        if(parent[x] < 0){
+            return x;
+        }
+        return parent[x] = find(parent[x]);
+    }
+};
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+template<typename DSU>
+long long runWorkload(DSU& dsu, const vector<pair<int,int>>& unions, const vector<int>& finds){
+    long long checksum = 0;
+    for(auto& [x, y] : unions)
+        dsu._union(x, y);
+    for(int x : finds)
+        checksum += dsu.find(x);
+    return checksum;
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+
+    mt19937 rng(12345);
+    vector<pair<string, pair<vector<pair<int,int>>, vector<int>>>> workloads;
+
+    {
+        vector<pair<int,int>> unions(n);
+        vector<int> finds(n);
+        for(auto& e : unions)
+            e = {int(rng() % n), int(rng() % n)};
+        for(int& x : finds)
+            x = rng() % n;
+        workloads.push_back({"random", {unions, finds}});
+    }
+    {
+        vector<pair<int,int>> unions;
+        vector<int> finds(n);
+        for(int i = 0; i + 1 < n; i++)
+            unions.push_back({i, i + 1});
+        iota(finds.begin(), finds.end(), 0);
+        workloads.push_back({"sequential", {unions, finds}});
+    }
+    {
+        vector<pair<int,int>> unions;
+        vector<int> finds(n);
+        for(int step = 1; step < n; step *= 2)
+            for(int i = 0; i + step < n; i += 2 * step)
+                unions.push_back({i + step, i});
+        iota(finds.begin(), finds.end(), 0);
+        workloads.push_back({"binomial", {unions, finds}});
+    }
+
+    cout<<"n = "<<n<<endl;
+    for(auto& [name, w] : workloads){
+        long long c1 = 0, c2 = 0;
+        double tNew = timeIt([&]{
+            DisjointSetUnion<> dsu(n);
+            c1 = runWorkload(dsu, w.first, w.second);
+        });
+        double tOld = timeIt([&]{
+            DisjointSetUnionRecursive dsu(n);
+            c2 = runWorkload(dsu, w.first, w.second);
+        });
+        cout<<name<<" : iterative "<<tNew<<" ms, recursive "<<tOld<<" ms"
+            <<(c1 == c2 ? "" : "  (MISMATCH)")<<endl;
+    }
+
+    // add_node growth from an empty structure
+    double tGrow = timeIt([&]{
+        DisjointSetUnion<> dsu(0);
+        for(int i = 0; i < n; i++){
+            int v = dsu.add_node();
+            if(v > 0)
+                dsu._union(v, rng() % v);
+        }
+    });
+    cout<<"add_node growth : "<<tGrow<<" ms"<<endl;
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+// Scaling benchmark : ConcurrentDisjointSetUnion from 1 to N threads
+// Usage : ./DSU_Concurrent_Benchmark [nodes] [edges] [maxThreads]
+//         (default 10^7 nodes, 10^8 edges, maxThreads = hardware_concurrency)
+// Compile with -pthread
+
+// Edge i of the synthetic graph is derived from a hash of i, so every thread generates its own slice
+// of the edge stream without a 10^8 edge array in memory.
+// Baseline is the sequential DisjointSetUnion (DSU_Template) behind a mutex, the way producers feed it today.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "DSU_Template"
+#include "DSU_Concurrent_Template"
+
+static inline uint64_t splitmix64(uint64_t x){
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+static inline pair<uint32_t,uint32_t> edgeAt(uint64_t i, uint32_t nodes){
+    uint64_t h = splitmix64(i);
+    return {uint32_t((h & 0xffffffffULL) % nodes), uint32_t((h >> 32) % nodes)};
+}
+
+template<typename F>
+double runThreads(int threads, uint64_t edges, F work){
+    auto start = chrono::steady_clock::now();
+    vector<thread> pool;
+    for(int t = 0; t < threads; t++){
+        uint64_t from = edges * t / threads, to = edges * (t + 1) / threads;
+        pool.emplace_back(work, from, to);
+    }
+    for(auto& th : pool)
+        th.join();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main(int argc, char** argv){
+    uint32_t nodes = argc > 1 ? atoll(argv[1]) : 10000000;
+    uint64_t edges = argc > 2 ? atoll(argv[2]) : 100000000;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : max(1u, thread::hardware_concurrency());
+
+    cout<<"nodes = "<<nodes<<", edges = "<<edges<<endl;
+
+    // 1, 2, 4, ... below maxThreads, then maxThreads itself
+    vector<int> sweep;
+    for(int threads = 1; threads < maxThreads; threads *= 2)
+        sweep.push_back(threads);
+    sweep.push_back(maxThreads);
+
+    for(int threads : sweep){
+        atomic<uint64_t> mergesLockFree{0}, mergesLocked{0};
+
+        ConcurrentDisjointSetUnion<> cdsu(nodes);
+        double tLockFree = runThreads(threads, edges, [&](uint64_t from, uint64_t to){
+            uint64_t merges = 0;
+            for(uint64_t i = from; i < to; i++){
+                auto [x, y] = edgeAt(i, nodes);
+                merges += cdsu._union(x, y);
+            }
+            mergesLockFree += merges;
+        });
+
+        DisjointSetUnion<> dsu(nodes);
+        mutex m;
+        double tLocked = runThreads(threads, edges, [&](uint64_t from, uint64_t to){
+            uint64_t merges = 0;
+            for(uint64_t i = from; i < to; i++){
+                auto [x, y] = edgeAt(i, nodes);
+                lock_guard<mutex> lock(m);
+                merges += dsu._union(x, y);
+            }
+            mergesLocked += merges;
+        });
+
+        // Both must end with the same number of components
+        cout<<threads<<" thread(s) : lock-free "<<tLockFree<<" ms ("<<edges / tLockFree / 1000<<" M edges/s), "
+            <<"mutex "<<tLocked<<" ms ("<<edges / tLocked / 1000<<" M edges/s)"
+            <<(mergesLockFree == mergesLocked ? "" : "  (MISMATCH)")<<endl;
+    }
+
+    return 0;
+}
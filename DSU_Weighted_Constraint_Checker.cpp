@@ -0,0 +1,53 @@
+// Constraint Checker - Weighted DSU
+
+/* Problem Statement :
+There are n ids with unknown integer values, and m constraints given one by one :
+    0 x y d : value[y] - value[x] = d
+    1 x y p : parity[x] ^ parity[y] = p     (p = 1 => x and y must be on different sides)
+    2 x y   : print value[y] - value[x] if it is already determined, else "?"
+After every constraint of type 0 or 1, print "OK" if all constraints so far can hold, else "CONFLICT"
+(a conflicting constraint is rejected and not added). */
+
+// Concept Used -> WeightedDisjointSetUnion with AdditiveGroup for offsets and XorGroup for parity,
+// instead of a BFS over the constraint graph for every batch
+
+// Time Complexity = O(m * alpha(n))
+// Space Complexity = O(n)
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "DSU_Weighted_Template"
+
+int main(){
+    ios_base::sync_with_stdio(false), cin.tie(NULL);
+
+    int n, m;
+    cin >> n >> m;
+
+    WeightedDisjointSetUnion<AdditiveGroup<long long>> offsets(n);
+    WeightedDisjointSetUnion<XorGroup<int>> parity(n);
+
+    while(m--){
+        int type, x, y;
+        cin >> type >> x >> y;
+        if(type == 0){
+            long long d;
+            cin >> d;
+            cout << (offsets.merge(x, y, d) ? "OK" : "CONFLICT") << '\n';
+        }
+        else if(type == 1){
+            int p;
+            cin >> p;
+            cout << (parity.merge(x, y, p) ? "OK" : "CONFLICT") << '\n';
+        }
+        else{
+            if(offsets.same(x, y))
+                cout << offsets.diff(x, y) << '\n';
+            else
+                cout << "?" << '\n';
+        }
+    }
+
+    return 0;
+}
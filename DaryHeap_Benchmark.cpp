@@ -0,0 +1,220 @@
+// Benchmark : DaryHeap (DaryHeap_Template) vs std::priority_queue and the old fixed capacity MaxHeap class
+// Usage : ./DaryHeap_Benchmark [n]     (default n = 10^7)
+
+// Workloads (all max heaps of int, every heap must produce the same checksum of the popped sequence)
+// 1. fill + drain - n random pushes, then n pops (heap sort order)
+// 2. steady       - a heap of n / 16 elements, then n times : pop the top, push top - random (Dijkstra / event queue like)
+// 3. bulk         - n random elements in one go (push_range / constructor vs n pushes), then n pops
+// Plus a move-only run : DaryHeap<unique_ptr<int>> with a pointee comparator.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "DaryHeap_Template"
+
+// The previous maxHeap_Implementation_Class.cpp, unchanged
+class OldMaxHeap{
+    vector<int> maxHeap;
+    int heapSize;
+    int realSize = 0;
+public:    
+     OldMaxHeap(int heapSize) {
+        this->heapSize = heapSize;
+        maxHeap.resize(heapSize);
+    }
+public:
+    // Function to add an element
+    void add(int element) {
+        realSize++;
+        // If the number of elements in the Heap exceeds the preset heapSize
+        // print "Added too many elements" and return
+        if (realSize > heapSize) {
+            cout<<"Added too many elements!"<<endl;
+            realSize--;
+            return;
+        }
+        
+        maxHeap[realSize] = element;  // Add the element into the array i.e. Add it to the rightMost child of bottom level
+        
+        // Now, restore the Heap
+        // Bubble it up the current Item if the current Item is greater than it's parent
+        int index = realSize;   // Index of the newly added Item
+        int parent = index / 2;
+        
+        // Looking at parent and Ask, "Am I greater than you(parent)"?
+        // If yes swap parent ant current Item
+        while(index > 1 && maxHeap[index] > maxHeap[parent]){
+            swap(maxHeap[index], maxHeap[parent]);
+            index = parent;
+            parent = index / 2;
+        }
+    }
+public:
+    // Get the top element of the Heap
+    int top() {
+        return maxHeap[1];
+    }
+public:
+    // Delete the top element of the Heap
+    void pop() {
+        // If the number of elements in the current Heap is 0,
+        // print "Don't have any elements" and return a default value
+        if (realSize < 1) {
+            cout<<"Don't have any element!"<<endl;
+            return;
+        } 
+        
+        // When there are still elements in the Heap i.e. realSize >= 1
+        maxHeap[1] = maxHeap[realSize]; // Put the last element in the Heap to the top of Heap i.e. Replace the rightMost child of bottom level with the top of heap.
+        realSize--;
+        
+        // Now, restore the Heap
+        // Bubble it down the current Item(i.e. top of maxHeap) if the current Item is less than it's left or right child
+        int index = 1;
+    
+        // Bubble it down, until we are not reach at the bottom level
+        while (index <= realSize / 2) {
+            int left = index * 2;        
+            int right = (index * 2) + 1;
+            
+            // Ask to left and right childs, "Am I smaller than any of you"?
+            // If yes, Then swap the parent with the larger value of the left and right child
+            if (maxHeap[index] < maxHeap[left] || maxHeap[index] < maxHeap[right]) {
+                if (maxHeap[left] > maxHeap[right]) {
+                    swap(maxHeap[index], maxHeap[left]);
+                    index = left;
+                } 
+                else {// maxHeap[left] <= maxHeap[right]
+                    swap(maxHeap[index], maxHeap[right]);
+                    index = right;
+                }
+            } 
+            else 
+                break;
+        } 
+    }
+public:
+    // Return the number of elements in the Heap
+    int size() {
+        return realSize;
+    }
+};
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+// same push / top / pop interface for all of them
+struct OldAdapter{
+    OldMaxHeap heap;
+    OldAdapter(int capacity) : heap(capacity){}
+    void push(int x){ heap.add(x); }
+    int top(){ return heap.top(); }
+    void pop(){ heap.pop(); }
+};
+
+struct StdAdapter{
+    priority_queue<int> heap;
+    StdAdapter(int){}
+    void push(int x){ heap.push(x); }
+    int top(){ return heap.top(); }
+    void pop(){ heap.pop(); }
+};
+
+template<int D>
+struct DaryAdapter{
+    DaryHeap<int, D> heap;
+    DaryAdapter(int capacity){ heap.reserve(capacity); }
+    void push(int x){ heap.push(x); }
+    int top(){ return heap.top(); }
+    void pop(){ heap.pop(); }
+};
+
+vector<int> values;
+int n;
+
+template<typename Heap>
+void run(const char* name){
+    unsigned long long c1 = 0, c2 = 0;
+    double t1, t2;
+    {
+        Heap h(n + 2);
+        t1 = timeIt([&]{
+            for(int x : values)
+                h.push(x);
+            for(int i = 0; i < n; i++){
+                c1 = c1 * 31 + h.top();
+                h.pop();
+            }
+        });
+    }
+    {
+        Heap h(n + 2);
+        int base = n / 16;
+        for(int i = 0; i < base; i++)
+            h.push(values[i]);
+        t2 = timeIt([&]{
+            for(int i = 0; i < n; i++){
+                int x = h.top();
+                c2 = c2 * 31 + x;
+                h.pop();
+                h.push(x - (values[i] & 1023));
+            }
+        });
+    }
+    cout<<name<<" : fill + drain "<<t1<<" ms, steady "<<t2<<" ms, checksums "<<c1<<" "<<c2<<endl;
+}
+
+template<int D>
+void runBulk(){
+    unsigned long long c1 = 0, c2 = 0;
+    DaryHeap<int, D> a, b;
+    double t1 = timeIt([&]{
+        for(int x : values)
+            a.push(x);
+    });
+    double t2 = timeIt([&]{ b.push_range(values.begin(), values.end()); });
+    for(int i = 0; i < n; i++){
+        c1 = c1 * 31 + a.top(), a.pop();
+        c2 = c2 * 31 + b.top(), b.pop();
+    }
+    cout<<"DaryHeap<int, "<<D<<"> build : n pushes "<<t1<<" ms, push_range "<<t2<<" ms"<<(c1 == c2 ? "" : "  (MISMATCH)")<<endl;
+}
+
+int main(int argc, char** argv){
+    n = argc > 1 ? atoi(argv[1]) : 10000000;
+    mt19937 rng(12345);
+    values.resize(n);
+    for(int& x : values)
+        x = rng() % 1000000000;
+
+    cout<<"n = "<<n<<endl;
+    run<OldAdapter>("old MaxHeap         ");
+    run<StdAdapter>("std::priority_queue ");
+    run<DaryAdapter<2>>("DaryHeap<int, 2>    ");
+    run<DaryAdapter<4>>("DaryHeap<int, 4>    ");
+    run<DaryAdapter<8>>("DaryHeap<int, 8>    ");
+
+    runBulk<2>();
+    runBulk<4>();
+
+    {
+        auto cmp = [](const unique_ptr<int>& a, const unique_ptr<int>& b){ return *a < *b; };
+        DaryHeap<unique_ptr<int>, 4, decltype(cmp)> heap(cmp);
+        unsigned long long c = 0;
+        int m = n / 10;
+        double t = timeIt([&]{
+            for(int i = 0; i < m; i++)
+                heap.push(make_unique<int>(values[i]));
+            while(!heap.empty())
+                c = c * 31 + *heap.extract();
+        });
+        cout<<"DaryHeap<unique_ptr<int>, 4> : "<<m<<" pushes + extracts "<<t<<" ms, checksum "<<c<<endl;
+    }
+
+    return 0;
+}
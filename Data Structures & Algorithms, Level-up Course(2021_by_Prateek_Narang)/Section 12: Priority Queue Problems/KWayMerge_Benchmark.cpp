@@ -0,0 +1,232 @@
+// Benchmark : k-way merge with a loser tree (KWayMerge_Template) vs the priority_queue versions
+// Usage : ./a.out [N] [dir]     (default N = 2^24 ints in total, temporary files in /tmp)
+
+// For k = 16, 256, 4096, 65536 sorted runs of N / k random ints :
+// arrays : Coding Exercise 45 (priority_queue of vector<int> triplets, as it is)
+//          priority_queue of tuple<int, int, int>
+//          mergeArrays
+// lists  : LeetCode 23 min heap of ListNode*, LeetCode 23 divide and conquer, mergeLists
+//          (nodes of each list are scattered over the pool like real allocations)
+// files  : mergeFiles over k files (64 MB of buffers in total, at most 1000 files open at once)
+// Every result is compared with the mergeArrays one.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "KWayMerge_Template"
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+// Coding Exercise 45, only empty arrays skipped (k > N leaves some runs empty) and a signedness cast
+vector<int> mergeKArrays(vector<vector<int>> arrays){
+    int k = arrays.size();
+
+    // triplet -> element, array_idx, element_idx
+    priority_queue < vector<int>, vector<vector<int>>, greater<vector<int>>> pq;
+
+    vector<int> res;
+
+    // initialize the min heap of size k
+    for (int i = 0; i < k;i++){
+        if(arrays[i].empty())
+            continue;
+        int element = arrays[i][0];
+        int arrayIdx = i;
+        int elementIdx = 0;
+
+        pq.push({element, arrayIdx, elementIdx});
+    }
+
+    // start popping and pushing
+    while(!pq.empty()){
+        vector<int> top = pq.top();
+        pq.pop();
+
+        int element = top[0];
+        int arrayIdx = top[1];
+        int elementIdx = top[2];
+
+        res.push_back(element);
+
+        if(elementIdx < (int)arrays[arrayIdx].size()-1){
+            int nextElementIdx = elementIdx + 1;
+            int nextElement = arrays[arrayIdx][nextElementIdx];
+
+            pq.push({nextElement, arrayIdx, nextElementIdx});
+        }
+    }
+    return res;
+}
+
+// the same with tuples and no copy of the input
+vector<int> mergeKArraysTuple(const vector<vector<int>>& arrays){
+    priority_queue<tuple<int,int,int>, vector<tuple<int,int,int>>, greater<tuple<int,int,int>>> pq;
+    size_t total = 0;
+    for(int i = 0; i < (int)arrays.size(); i++){
+        total += arrays[i].size();
+        if(!arrays[i].empty())
+            pq.push({arrays[i][0], i, 0});
+    }
+    vector<int> res;
+    res.reserve(total);
+    while(!pq.empty()){
+        auto [element, arrayIdx, elementIdx] = pq.top();
+        pq.pop();
+        res.push_back(element);
+        if(elementIdx + 1 < (int)arrays[arrayIdx].size())
+            pq.push({arrays[arrayIdx][elementIdx + 1], arrayIdx, elementIdx + 1});
+    }
+    return res;
+}
+
+struct ListNode{
+    int val;
+    ListNode* next;
+    ListNode(int x = 0) : val(x), next(nullptr){}
+};
+
+// LeetCode 23, min heap (the comparator without its "return true" on equal values, which is not a strict order)
+ListNode* mergeKListsHeap(vector<ListNode*>& lists){
+    auto cmp = [](ListNode* a, ListNode* b){ return a->val > b->val; };
+    priority_queue<ListNode*, vector<ListNode*>, decltype(cmp)> min_heap(cmp);
+    for(auto& node : lists)
+        if(node != nullptr)
+            min_heap.push(node);
+    ListNode dummy(-1);
+    ListNode *cur, *prev = &dummy;
+    while(!min_heap.empty()){
+        cur = min_heap.top();
+        min_heap.pop();
+        prev->next = cur;
+        prev = prev->next;
+        if(cur->next != nullptr)
+            min_heap.push(cur->next);
+    }
+    return dummy.next;
+}
+
+// LeetCode 23, divide and conquer
+ListNode* mergeTwo(ListNode* head1, ListNode* head2){
+    ListNode dummy(-1);
+    ListNode* tail = &dummy;
+    while(head1 && head2){
+        if(head1->val <= head2->val)
+            tail->next = head1, head1 = head1->next;
+        else
+            tail->next = head2, head2 = head2->next;
+        tail = tail->next;
+    }
+    tail->next = head1 ? head1 : head2;
+    return dummy.next;
+}
+
+ListNode* mergeKListsDivide(vector<ListNode*>& lists, int start, int end){
+    if(start > end)
+        return nullptr;
+    if(start == end)
+        return lists[start];
+    int mid = start + (end - start) / 2;
+    return mergeTwo(mergeKListsDivide(lists, start, mid), mergeKListsDivide(lists, mid + 1, end));
+}
+
+int main(int argc, char** argv){
+    int N = argc > 1 ? atoi(argv[1]) : 1 << 24;
+    string dir = argc > 2 ? argv[2] : "/tmp";
+
+    mt19937 rng(12345);
+    for(int k : {16, 256, 4096, 65536}){
+        vector<vector<int>> arrays(k);
+        for(int i = 0; i < N; i++)
+            arrays[i % k].push_back(rng() % 1000000000);
+        for(auto& a : arrays)
+            sort(a.begin(), a.end());
+        cout<<"k = "<<k<<", N = "<<N<<endl;
+
+        // arrays
+        vector<int> expected, res;
+        double tTree = timeIt([&]{ expected = mergeArrays(arrays); });
+        double tVec = timeIt([&]{ res = mergeKArrays(arrays); });
+        bool okVec = res == expected;
+        double tTuple = timeIt([&]{ res = mergeKArraysTuple(arrays); });
+        bool okTuple = res == expected;
+        cout<<"  arrays : exercise 45 "<<tVec<<" ms"<<(okVec ? "" : " MISMATCH")<<", tuple heap "<<tTuple<<" ms"
+            <<(okTuple ? "" : " MISMATCH")<<", loser tree "<<tTree<<" ms"<<endl;
+
+        // lists, node j of a list is anywhere in the pool
+        vector<ListNode> pool(N);
+        vector<int> slot(N);
+        iota(slot.begin(), slot.end(), 0);
+        shuffle(slot.begin(), slot.end(), rng);
+        vector<ListNode*> heads(k);
+        auto build = [&]{
+            int used = 0;
+            for(int i = 0; i < k; i++){
+                ListNode* prev = nullptr;
+                for(int x : arrays[i]){
+                    ListNode* node = &pool[slot[used++]];
+                    node->val = x, node->next = nullptr;
+                    (prev ? prev->next : heads[i]) = node;
+                    prev = node;
+                }
+            }
+        };
+        auto matches = [&](ListNode* head){
+            for(int x : expected){
+                if(head == nullptr || head->val != x)
+                    return false;
+                head = head->next;
+            }
+            return head == nullptr;
+        };
+        ListNode* head;
+        build();
+        double tHeap = timeIt([&]{ head = mergeKListsHeap(heads); });
+        bool okHeap = matches(head);
+        build();
+        double tDivide = timeIt([&]{ head = mergeKListsDivide(heads, 0, k - 1); });
+        bool okDivide = matches(head);
+        build();
+        double tLists = timeIt([&]{ head = mergeLists(heads); });
+        bool okLists = matches(head);
+        cout<<"  lists  : heap "<<tHeap<<" ms"<<(okHeap ? "" : " MISMATCH")<<", divide and conquer "<<tDivide<<" ms"
+            <<(okDivide ? "" : " MISMATCH")<<", loser tree "<<tLists<<" ms"<<(okLists ? "" : " MISMATCH")<<endl;
+        pool.clear(), pool.shrink_to_fit();
+
+        // files
+        vector<string> names(k);
+        for(int i = 0; i < k; i++){
+            names[i] = dir + "/kway_run_" + to_string(i) + ".bin";
+            FILE* f = fopen(names[i].c_str(), "wb");
+            bool saved = f != nullptr
+                && fwrite(arrays[i].data(), sizeof(int), arrays[i].size(), f) == arrays[i].size();
+            if(f == nullptr || fclose(f) != 0 || !saved){
+                cout<<"can't write "<<names[i]<<endl;
+                for(int j = 0; j <= i; j++)
+                    remove(names[j].c_str());
+                return 1;
+            }
+        }
+        string out = dir + "/kway_merged.bin";
+        size_t bufferBytes = max<size_t>(4096, min<size_t>(1 << 16, (64 << 20) / (min(k, 1000) + 1)));
+        size_t written;
+        double tFiles = timeIt([&]{ written = mergeFiles<int>(names, out, bufferBytes); });
+        vector<int> back(written);
+        FILE* f = fopen(out.c_str(), "rb");
+        bool okFiles = f != nullptr && fread(back.data(), sizeof(int), written, f) == written && back == expected;
+        if(f != nullptr)
+            fclose(f);
+        cout<<"  files  : loser tree "<<tFiles<<" ms ("<<N * sizeof(int) / tFiles / 1000<<" MB/s, buffers of "
+            <<bufferBytes<<" bytes"<<(k > 1000 ? ", 2 passes" : "")<<")"<<(okFiles ? "" : " MISMATCH")<<endl;
+        for(auto& name : names)
+            remove(name.c_str());
+        remove(out.c_str());
+    }
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+// Benchmark : KLL sketch (QuantileSketch_Template) vs the exact MedianHandler (Coding Exercise 44)
+// Usage : ./a.out [N] [threads]     (default N = 10^7 samples, 4 threads)
+
+// Stream : log-normal latencies in microseconds whose scale drifts, with 1 in 1000 samples a 10 - 100 ms spike.
+// Running median : both get every sample, every N / 100 samples the sketch median is compared with the exact one.
+// Final quantiles : q = 0.01 .. 0.999 of one sketch over the whole stream, and of per thread sketches
+// (each thread sketches a contiguous part, so the parts look different) merged into one.
+// Error = rank error : how far the rank of the returned value is from floor(q * (n - 1)), as a fraction of n
+// (a value repeated in the stream covers a range of ranks, the distance to that range counts).
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "../../Segment Tree/FenwickTree_Template"
+#include "QuantileSketch_Template"
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+// Coding Exercise 44, unchanged
+class MedianHandler{
+public:
+    float median;
+	priority_queue<int> leftHeap;   // max heap
+    priority_queue<int, vector<int>, greater<int>> rightHeap; // min heap
+
+    //Complete this method to update median after every insertion
+    void push(int number){
+        // Initialization
+        if(leftHeap.empty() && rightHeap.empty()){
+            leftHeap.push(number);
+            return;
+        }
+
+        median = getMedian();
+
+        // left or right or equal
+        if(leftHeap.size() > rightHeap.size()){
+            if(number < median){
+                    rightHeap.push(leftHeap.top());	// push root of left heap into right heap
+                    leftHeap.pop();
+                    leftHeap.push(number);	// now push current element into left heap
+            }
+            else{
+                    rightHeap.push(number);
+            }
+        }
+        else if(leftHeap.size() == rightHeap.size()){
+                if(number < median){
+                    leftHeap.push(number);
+                }
+                else{
+                    rightHeap.push(number);
+                }
+        }
+        else{
+            if(number < median){
+                    leftHeap.push(number);
+            }
+            else{
+                    leftHeap.push(rightHeap.top());	// push root of right heap into left heap
+                    rightHeap.pop();
+                    rightHeap.push(number);	// now push current element into right heap
+            }
+        }
+    }
+
+    //Complete this , Should return the median in O(1) time
+    float getMedian(){
+        if(leftHeap.size() > rightHeap.size()){
+            median = leftHeap.top();
+        }
+        else if(rightHeap.size() > leftHeap.size()){
+            median = rightHeap.top();
+        }
+        else{
+            int mid1 = leftHeap.top();
+            int mid2 = rightHeap.top();
+            median  = mid1 + (mid2-mid1)/2.0;
+        }
+        return median;
+    }
+};
+
+const int U = 1 << 20;
+
+// rank error of value v for target rank r among n samples, counts = Fenwick tree of sample counts per value
+double rankError(const FenwickTree<int>& counts, long long n, int v, long long r){
+    long long lo = counts.prefix(v - 1), hi = counts.prefix(v) - 1;      // ranks covered by v
+    long long off = r < lo ? lo - r : r > hi ? r - hi : 0;
+    return (double)off / n;
+}
+
+int main(int argc, char** argv){
+    long long N = argc > 1 ? atoll(argv[1]) : 10000000;
+    int threads = argc > 2 ? atoi(argv[2]) : 4;
+
+    mt19937 rng(12345);
+    vector<int> stream(N);
+    normal_distribution<double> noise(0, 0.8);
+    for(long long i = 0; i < N; i++){
+        double scale = 6 + 0.7 * sin(i * 6.0 / N);
+        double x = rng() % 1000 == 0 ? 10000 + rng() % 90000 : exp(scale + noise(rng));
+        stream[i] = min<double>(x, U - 1);
+    }
+    cout<<"N = "<<N<<endl;
+
+    // running median : exact vs k = 200
+    {
+        MedianHandler exact;
+        KLLSketch<int> sketch(200);
+        FenwickTree<int> counts(U);
+        double worst = 0, total = 0;
+        int checks = 0;
+        double tExact = 0, tSketch = 0;
+        long long step = max(1LL, N / 100);
+        for(long long from = 0; from < N; from += step){
+            long long to = min(N, from + step);
+            tExact += timeIt([&]{ for(long long i = from; i < to; i++) exact.push(stream[i]); });
+            tSketch += timeIt([&]{ for(long long i = from; i < to; i++) sketch.push(stream[i]); });
+            for(long long i = from; i < to; i++)
+                counts.add(stream[i], 1);
+            // the sketch median as the value of rank (n - 1) / 2, the exact one is an average of two values
+            double err = rankError(counts, to, sketch.quantile(0.5), (to - 1) / 2);
+            worst = max(worst, err), total += err, checks++;
+            if(to == N)
+                cout<<"final median : exact "<<exact.getMedian()<<", sketch "<<sketch.getMedian()<<endl;
+        }
+        size_t exactBytes = (exact.leftHeap.size() + exact.rightHeap.size()) * sizeof(int);
+        cout<<"running median over "<<checks<<" checkpoints, k = 200 : mean rank error "<<100 * total / checks
+            <<"%, worst "<<100 * worst<<"%"<<endl;
+        cout<<"  MedianHandler "<<tExact * 1e6 / N<<" ns/push, "<<exactBytes / (1 << 20)<<" MB of samples"<<endl;
+        cout<<"  KLLSketch     "<<tSketch * 1e6 / N<<" ns/push, "<<sketch.memoryBytes() / 1024<<" KB ("
+            <<sketch.size()<<" samples kept)"<<endl;
+    }
+
+    // final quantiles : one sketch vs per thread sketches merged
+    FenwickTree<int> counts(U);
+    for(int x : stream)
+        counts.add(x, 1);
+    vector<double> qs = {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999};
+    for(int k : {200, 1000}){
+        KLLSketch<int> single(k);
+        for(int x : stream)
+            single.push(x);
+
+        vector<KLLSketch<int>> parts;
+        for(int t = 0; t < threads; t++)
+            parts.emplace_back(k, 1234567 + 7919 * t);
+        vector<thread> pool;
+        for(int t = 0; t < threads; t++)
+            pool.emplace_back([&, t]{
+                for(long long i = N * t / threads; i < N * (t + 1) / threads; i++)
+                    parts[t].push(stream[i]);
+            });
+        for(auto& th : pool)
+            th.join();
+        KLLSketch<int> merged(k);
+        for(auto& part : parts)
+            merged.merge(part);
+
+        cout<<"k = "<<k<<" : single sketch keeps "<<single.size()<<" samples, merged ("<<threads<<" threads) "
+            <<merged.size()<<endl;
+        cout<<"  q        exact    single  (error)   merged  (error)"<<endl;
+        double worstSingle = 0, worstMerged = 0;
+        for(double q : qs){
+            long long r = (long long)(q * (N - 1));
+            int exactValue = counts.lower_bound(r + 1);
+            int a = single.quantile(q), b = merged.quantile(q);
+            double ea = rankError(counts, N, a, r), eb = rankError(counts, N, b, r);
+            worstSingle = max(worstSingle, ea), worstMerged = max(worstMerged, eb);
+            cout<<"  "<<left<<setw(8)<<q<<right<<setw(6)<<exactValue<<setw(10)<<a<<setw(8)<<fixed<<setprecision(3)
+                <<100 * ea<<"%"<<setw(9)<<b<<setw(8)<<100 * eb<<"%"<<defaultfloat<<setprecision(6)<<endl;
+        }
+        cout<<"  worst rank error : single "<<100 * worstSingle<<"%, merged "<<100 * worstMerged<<"%"<<endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,161 @@
+// Benchmark : rolling latency percentiles over the last W samples (SlidingQuantile_Template)
+// Usage : ./a.out [N] [W]     (default N = 10^8 samples, window W = 10^5)
+
+// Stream : log-normal latencies in microseconds (median ~400 us) whose scale drifts slowly and with 1 in 1000
+// samples a 10 - 100 ms spike, clamped to [0, 2^20). After every sample : push it, evict the oldest once the
+// window is full, read the median and the p99.
+// 1. two heaps with lazy deletion : SlidingQuantile(0.5) for the median + SlidingQuantile(0.99) for the p99
+// 2. WindowQuantile (Fenwick tree over the 2^20 values) answering both
+// 3. recompute (what MedianHandler forces) : copy the window, nth_element for both, timed on 2000 samples only
+// Checksums (sum of medians, sum of p99s) of 1 and 2 must match. A brute force check on small windows runs first.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "../../Segment Tree/FenwickTree_Template"
+#include "SlidingQuantile_Template"
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+const int U = 1 << 20;
+
+// sorted copy of the window
+bool bruteCheck(mt19937& rng){
+    vector<double> qs = {0, 0.25, 0.5, 0.9, 0.99, 1};
+    for(int W = 1; W <= 40; W++){
+        vector<SlidingQuantile<int>> heaps;
+        for(double q : qs)
+            heaps.emplace_back(q);
+        WindowQuantile fenwick(64);
+        deque<int> window;
+        for(int i = 0; i < 3000; i++){
+            int x = rng() % (i % 500 < 250 ? 8 : 64);
+            window.push_back(x);
+            fenwick.push(x);
+            for(auto& h : heaps)
+                h.push(x);
+            if((int)window.size() > W || rng() % 5 == 0){
+                window.pop_front();
+                fenwick.evict_oldest();
+                for(auto& h : heaps)
+                    h.evict_oldest();
+            }
+            if(window.empty())
+                continue;
+            vector<int> sorted(window.begin(), window.end());
+            sort(sorted.begin(), sorted.end());
+            int n = sorted.size();
+            double median = sorted[(n - 1) / 2] + (sorted[n / 2] - sorted[(n - 1) / 2]) / 2.0;
+            if(fenwick.getMedian() != median || heaps[2].getMedian() != median)
+                return false;
+            for(int j = 0; j < (int)qs.size(); j++){
+                int expected = sorted[(int)(qs[j] * (n - 1))];
+                if(fenwick.quantile(qs[j]) != expected || heaps[j].quantile() != expected)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv){
+    long long N = argc > 1 ? atoll(argv[1]) : 100000000;
+    int W = argc > 2 ? atoi(argv[2]) : 100000;
+
+    mt19937 rng(12345);
+    if(!bruteCheck(rng)){
+        cout<<"MISMATCH against brute force"<<endl;
+        return 1;
+    }
+    cout<<"brute force check : OK"<<endl;
+
+    vector<int> stream(N);
+    normal_distribution<double> noise(0, 0.8);
+    for(long long i = 0; i < N; i++){
+        double scale = 6 + 0.5 * sin(i / 3e6);
+        double x = rng() % 1000 == 0 ? 10000 + rng() % 90000 : exp(scale + noise(rng));
+        stream[i] = min<double>(x, U - 1);
+    }
+    cout<<"N = "<<N<<", window = "<<W<<endl;
+
+    auto report = [&](const char* name, double ms, long long queries, double medians, long long p99s){
+        cout<<name<<" : "<<ms<<" ms, "<<ms * 1e6 / queries<<" ns/sample, checksums "<<fixed<<setprecision(1)
+            <<medians<<" "<<p99s<<defaultfloat<<setprecision(6)<<endl;
+    };
+
+    // checksums of 1, compared with 2
+    double heapMedians = 0;
+    long long heapP99s = 0;
+
+    // 1. two heaps, one per quantile
+    {
+        size_t peak = 0;
+        SlidingQuantile<int> median(0.5), p99(0.99);
+        double ms = timeIt([&]{
+            for(long long i = 0; i < N; i++){
+                median.push(stream[i]);
+                p99.push(stream[i]);
+                if((int)median.size() > W){
+                    median.evict_oldest();
+                    p99.evict_oldest();
+                }
+                heapMedians += median.getMedian();
+                heapP99s += p99.quantile();
+                peak = max(peak, median.heapSizes());
+            }
+        });
+        report("two heaps, lazy deletion ", ms, N, heapMedians, heapP99s);
+        cout<<"  median heaps peak at "<<peak<<" samples (alive + dead) for a window of "<<W<<endl;
+    }
+
+    // 2. Fenwick tree over quantized values
+    {
+        double medians = 0;
+        long long p99s = 0;
+        WindowQuantile window(U);
+        double ms = timeIt([&]{
+            for(long long i = 0; i < N; i++){
+                window.push(stream[i]);
+                if((int)window.size() > W)
+                    window.evict_oldest();
+                medians += window.getMedian();
+                p99s += window.quantile(0.99);
+            }
+        });
+        report("WindowQuantile (Fenwick) ", ms, N, medians, p99s);
+        if(medians != heapMedians || p99s != heapP99s){
+            cout<<"MISMATCH between the two heaps and WindowQuantile"<<endl;
+            return 1;
+        }
+    }
+
+    // 3. recompute from scratch, only for the 2000 samples after the window first fills
+    {
+        long long from = min<long long>(W, N - 1), to = min<long long>(N, from + 2000);
+        vector<int> buf;
+        double medians = 0;
+        long long p99s = 0;      // kept so the loop is not optimized away
+        double ms = timeIt([&]{
+            for(long long i = from; i < to; i++){
+                buf.assign(stream.begin() + max(0LL, i + 1 - W), stream.begin() + i + 1);
+                int n = buf.size();
+                nth_element(buf.begin(), buf.begin() + n / 2, buf.end());
+                int mid2 = buf[n / 2];
+                int mid1 = *max_element(buf.begin(), buf.begin() + n / 2 + (n % 2));
+                medians += mid1 + (mid2 - mid1) / 2.0;
+                nth_element(buf.begin(), buf.begin() + (int)(0.99 * (n - 1)), buf.end());
+                p99s += buf[(int)(0.99 * (n - 1))];
+            }
+        });
+        cout<<"recompute (2000 samples)  : "<<ms<<" ms, "<<ms * 1e6 / (to - from)<<" ns/sample, ~"
+            <<ms * N / (to - from) / 1000<<" s for the whole stream"<<endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+// Benchmark : Dijkstra with set<pair<dist, node>> (the old 192. Dijkshtra's Algorithm Code.cpp) vs
+// a lazy priority_queue vs IndexedHeap (IndexedHeap_Template) with decrease_key, on a road-like graph
+// Usage : ./a.out [side]     (default side = 2237 : a side x side grid, ~5 * 10^6 vertices, ~10^7 edges)
+
+// Road-like graph : a grid (every vertex joined to its right and lower neighbour, weight 1 .. 1000)
+// plus a few long "highway" edges (1 in 64 vertices, to a random vertex, weight 10^6 .. 2 * 10^6).
+// Stored once as a flat adjacency array (CSR), so only the priority queue differs between the runs.
+// All versions must give the same distances (checksum = sum of the distances).
+// Before that, IndexedHeap push / update / erase / pop are checked against a set on random operations.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "../../IndexedHeap_Template"
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+struct CSRGraph{
+    int V;
+    vector<int> start;                  // edges of u are adj[start[u] .. start[u + 1] - 1]
+    vector<pair<int,int>> adj;          // {wt, nbr} like the list of 192
+
+    CSRGraph(int V, const vector<array<int,3>>& edges) : V(V), start(V + 1, 0), adj(2 * edges.size()){
+        for(auto& [u, v, wt] : edges)
+            start[u + 1]++, start[v + 1]++;
+        for(int i = 0; i < V; i++)
+            start[i + 1] += start[i];
+        vector<int> fill(start.begin(), start.end() - 1);
+        for(auto& [u, v, wt] : edges){
+            adj[fill[u]++] = {wt, v};
+            adj[fill[v]++] = {wt, u};
+        }
+    }
+};
+
+// the loop of 192 as it was
+vector<int> dijkstraSet(const CSRGraph& g, int src){
+    vector<int> dist(g.V, INT_MAX);
+    set<pair<int,int>> s;
+    dist[src] = 0;
+    s.insert({0, src});
+    while(!s.empty()){
+        auto it = s.begin();
+        int node = it->second, distTillNow = it->first;
+        s.erase(it);
+        for(int e = g.start[node]; e < g.start[node + 1]; e++){
+            auto [edgeDist, nbr] = g.adj[e];
+            if(distTillNow + edgeDist < dist[nbr]){
+                auto found = s.find({dist[nbr], nbr});
+                if(found != s.end())
+                    s.erase(found);
+                dist[nbr] = distTillNow + edgeDist;
+                s.insert({dist[nbr], nbr});
+            }
+        }
+    }
+    return dist;
+}
+
+// the usual contest version : push duplicates, skip the stale ones when popped
+vector<int> dijkstraLazy(const CSRGraph& g, int src){
+    vector<int> dist(g.V, INT_MAX);
+    priority_queue<pair<int,int>, vector<pair<int,int>>, greater<pair<int,int>>> pq;
+    dist[src] = 0;
+    pq.push({0, src});
+    while(!pq.empty()){
+        auto [distTillNow, node] = pq.top();
+        pq.pop();
+        if(distTillNow != dist[node])
+            continue;
+        for(int e = g.start[node]; e < g.start[node + 1]; e++){
+            auto [edgeDist, nbr] = g.adj[e];
+            if(distTillNow + edgeDist < dist[nbr]){
+                dist[nbr] = distTillNow + edgeDist;
+                pq.push({dist[nbr], nbr});
+            }
+        }
+    }
+    return dist;
+}
+
+template<int D>
+vector<int> dijkstraIndexed(const CSRGraph& g, int src){
+    vector<int> dist(g.V, INT_MAX);
+    IndexedHeap<int, D> pq(g.V);
+    dist[src] = 0;
+    pq.push(src, 0);
+    while(!pq.empty()){
+        int node = pq.top_id(), distTillNow = pq.top_key();
+        pq.pop();
+        for(int e = g.start[node]; e < g.start[node + 1]; e++){
+            auto [edgeDist, nbr] = g.adj[e];
+            if(distTillNow + edgeDist < dist[nbr]){
+                dist[nbr] = distTillNow + edgeDist;
+                pq.push_or_decrease(nbr, dist[nbr]);
+            }
+        }
+    }
+    return dist;
+}
+
+// random push / update / erase / pop against set<pair<key, id>>
+template<int D>
+bool heapCheck(mt19937& rng){
+    int n = 1000;
+    IndexedHeap<int, D> heap(n);
+    vector<int> key(n);
+    set<pair<int,int>> s;
+    for(int step = 0; step < 200000; step++){
+        int id = rng() % n, k = rng() % 5000, op = rng() % 4;
+        bool in = s.count({key[id], id});
+        if(in != heap.contains(id))
+            return false;
+        if(op == 0 && !in){
+            heap.push(id, k);
+            s.insert({k, id}), key[id] = k;
+        }
+        else if(op == 1){
+            heap.update(id, k);
+            if(in)
+                s.erase({key[id], id});
+            s.insert({k, id}), key[id] = k;
+        }
+        else if(op == 2){
+            heap.erase(id);
+            if(in)
+                s.erase({key[id], id});
+        }
+        else if(!s.empty()){
+            if(heap.top_key() != s.begin()->first || heap.key(heap.top_id()) != heap.top_key())
+                return false;
+            s.erase({heap.top_key(), heap.top_id()});
+            heap.pop();
+        }
+        if(heap.size() != s.size())
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv){
+    int side = argc > 1 ? atoi(argv[1]) : 2237;
+
+    mt19937 rng(12345);
+    bool ok = heapCheck<2>(rng) && heapCheck<4>(rng);
+    cout<<"IndexedHeap check against set : "<<(ok ? "OK" : "MISMATCH")<<endl;
+    if(!ok)
+        return 1;
+
+    int V = side * side;
+    vector<array<int,3>> edges;
+    edges.reserve(2 * (size_t)V + V / 64);
+    for(int r = 0; r < side; r++)
+        for(int c = 0; c < side; c++){
+            int u = r * side + c;
+            if(c + 1 < side)
+                edges.push_back({u, u + 1, (int)(rng() % 1000) + 1});
+            if(r + 1 < side)
+                edges.push_back({u, u + side, (int)(rng() % 1000) + 1});
+            if(rng() % 64 == 0)
+                edges.push_back({u, (int)(rng() % V), (int)(rng() % 1000000) + 1000000});
+        }
+    CSRGraph g(V, edges);
+    edges.clear();
+    edges.shrink_to_fit();
+    cout<<"V = "<<V<<", E = "<<g.adj.size() / 2<<endl;
+
+    int src = rng() % V;
+    auto checksum = [](const vector<int>& dist){
+        long long s = 0;
+        for(int d : dist)
+            s += d;
+        return s;
+    };
+    auto run = [&](const char* name, auto f){
+        vector<int> dist;
+        double t = timeIt([&]{ dist = f(g, src); });
+        cout<<name<<" : "<<t<<" ms, checksum "<<checksum(dist)<<endl;
+    };
+
+    run("set<pair<int,int>>      ", dijkstraSet);
+    run("lazy priority_queue     ", dijkstraLazy);
+    run("IndexedHeap<int, 2>     ", dijkstraIndexed<2>);
+    run("IndexedHeap<int, 4>     ", dijkstraIndexed<4>);
+
+    return 0;
+}
@@ -1,8 +1,13 @@
-// Time = O(V+E), Space = O(V+E)
+// Time = O((V+E)logV), Space = O(V+E)
 // SSSP in weighted undirected graph
+// The frontier is an IndexedHeap (IndexedHeap_Template) keyed by vertex : a shorter distance lowers the key of
+// the vertex in place (decrease_key), instead of set::find + erase + insert of {dist, vertex}.
+// See "192. Dijkshtra's Algorithm Benchmark.cpp" for both versions on a large road-like graph.
  
 #include<bits/stdc++.h>
 using namespace std;
+
+#include "../../IndexedHeap_Template"
  
 class Graph{
 	int V;
@@ -24,17 +29,16 @@ public:
 	int dijkshtra(int src, int dest){
 		// Data Structures
 		vector<int> dist(V,INT_MAX);	// It solves two purpose - store distance and tells if node is not visited => dist = INT_MAX
-		set<pair<int,int>> s;	// comparison for sorting based upon first value of pair
+		IndexedHeap<int> pq(V);	// min heap of {dist, node}, every node at most once
 		
 		// Initialization
 		dist[src] = 0;
-		s.insert({dist[src], src});
+		pq.push(src, dist[src]);
 		
-		while(!s.empty()){
-			auto it = s.begin();
-			int node = it->second;
-			int distTillNow = it->first;
-			s.erase(it);	// Pop
+		while(!pq.empty()){
+			int node = pq.top_id();
+			int distTillNow = pq.top_key();
+			pq.pop();
  
 			// Iterate over the nbrs of node	
 			for(auto nbrPair : adjList[node]){
@@ -42,15 +46,9 @@ public:
 				int edgeDist = nbrPair.first;
 				
 				if(distTillNow + edgeDist < dist[nbr]){
-					// If this nbr is already in set, Remove it
-					auto found = s.find({dist[nbr], nbr});
-					if(found != s.end()){
-						s.erase(found);
-					}
- 
-					// Update distance
+					// Update distance, if nbr is already in the heap its key goes down in place
 					dist[nbr] = distTillNow + edgeDist;
-					s.insert({dist[nbr],nbr});
+					pq.push_or_decrease(nbr, dist[nbr]);
 				}
 			}
 		}
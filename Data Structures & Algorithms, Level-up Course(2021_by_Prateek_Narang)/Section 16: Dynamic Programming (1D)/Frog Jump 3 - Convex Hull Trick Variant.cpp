@@ -0,0 +1,106 @@
+// Frog Jump 3 (AtCoder DP Z) - the frog may jump from stone j to any later stone i,
+// paying (h[i] - h[j])^2 + C. Minimum cost to reach the last stone.
+// Usage : ./a.out [n]     (1 <= n <= 10^6, default 10^6, random heights, prints the answers and timings)
+
+// dp[i] = min over j < i of dp[j] + (h[i] - h[j])^2 + C
+//       = min over j < i of (-2 h[j]) * h[i] + (dp[j] + h[j]^2)   +   h[i]^2 + C
+// so stone j is the line m = -2 h[j], b = dp[j] + h[j]^2 queried at x = h[i] (ConvexHullTrick_Template).
+
+// Naive (as in 209. Frog's Min Cost-I / Coding Exercise 62, with k = i)    Time = O(n^2)
+// Li Chao tree, any heights                                                   Time = O(n log H)
+// Monotone CHT, increasing heights (the AtCoder constraint)                  Time = O(n)
+// Space = O(n) for all three
+
+// The |h[i] - h[j]| cost of 209 / Coding Exercise 62 is not a line in h[i], and with a window of k stones
+// lines would have to be removed again, so those two stay with their O(n * k) loops.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "ConvexHullTrick_Template"
+
+long long naive(const vector<long long>& h, long long C){
+    int n = h.size();
+    vector<long long> dp(n, LLONG_MAX);
+    dp[0] = 0;
+    for(int i = 1; i < n; i++)
+        for(int j = 0; j < i; j++)
+            dp[i] = min(dp[i], dp[j] + (h[i] - h[j]) * (h[i] - h[j]) + C);
+    return dp[n - 1];
+}
+
+long long liChao(const vector<long long>& h, long long C, long long maxH){
+    int n = h.size();
+    LiChaoTree<long long> tree(0, maxH, n);
+    long long dp = 0;
+    for(int i = 0; i < n; i++){
+        if(i > 0)
+            dp = tree.query(h[i]) + h[i] * h[i] + C;
+        tree.addLine({-2 * h[i], dp + h[i] * h[i]});
+    }
+    return dp;
+}
+
+// h must be strictly increasing : slopes -2 h[j] decrease and queries h[i] increase
+long long monotoneCHT(const vector<long long>& h, long long C){
+    int n = h.size();
+    MonotoneCHT<long long> hull;
+    long long dp = 0;
+    for(int i = 0; i < n; i++){
+        if(i > 0)
+            dp = hull.queryMonotone(h[i]) + h[i] * h[i] + C;
+        hull.addLine({-2 * h[i], dp + h[i] * h[i]});
+    }
+    return dp;
+}
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    const long long C = 1000000000000LL, maxH = 1000000;
+    // the increasing run needs n distinct heights out of 1 .. maxH
+    if(n < 1 || n > maxH){
+        cout<<"n must be in [1, "<<maxH<<"]"<<endl;
+        return 1;
+    }
+
+    mt19937 rng(12345);
+    // strictly increasing heights (AtCoder limits : h <= 10^6, so n <= 10^6)
+    vector<long long> sorted(maxH);
+    iota(sorted.begin(), sorted.end(), 1);
+    shuffle(sorted.begin(), sorted.end(), rng);
+    sorted.resize(n);
+    sort(sorted.begin(), sorted.end());
+    // any heights
+    vector<long long> shuffled(n);
+    for(auto& x : shuffled)
+        x = rng() % maxH + 1;
+
+    cout<<"n = "<<n<<endl;
+
+    long long a1, a2, a3, b1, b2;
+    double t1 = timeIt([&]{ a1 = monotoneCHT(sorted, C); });
+    double t2 = timeIt([&]{ a2 = liChao(sorted, C, maxH); });
+    cout<<"increasing h : monotone CHT "<<a1<<" in "<<t1<<" ms, Li Chao "<<a2<<" in "<<t2<<" ms"<<endl;
+    double t3 = timeIt([&]{ b1 = liChao(shuffled, C, maxH); });
+    cout<<"any h        : Li Chao "<<b1<<" in "<<t3<<" ms"<<endl;
+
+    // the O(n^2) loop only on a prefix, checked against both
+    int m = min(n, 20000);
+    vector<long long> prefixSorted(sorted.begin(), sorted.begin() + m), prefixAny(shuffled.begin(), shuffled.begin() + m);
+    double t4 = timeIt([&]{ a3 = naive(prefixSorted, C); });
+    b2 = naive(prefixAny, C);
+    cout<<"naive O(n^2) on the first "<<m<<" stones : "<<t4<<" ms (~"<<t4 * ((double)n / m) * ((double)n / m) / 1000
+        <<" s for all n)"<<endl;
+    bool ok = a3 == monotoneCHT(prefixSorted, C) && a3 == liChao(prefixSorted, C, maxH) && b2 == liChao(prefixAny, C, maxH);
+    cout<<(ok ? "answers match" : "MISMATCH")<<endl;
+
+    return 0;
+}
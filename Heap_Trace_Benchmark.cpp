@@ -0,0 +1,298 @@
+// Benchmark : every priority queue of the repo replays the same operation traces
+// Usage : ./Heap_Trace_Benchmark [scale]     (default scale = 1, 0.1 for a quick run)
+
+// A trace is a list of push(id, key) / decrease(id, key) / pop() on unsigned keys, pop takes the smallest key.
+// Traces
+// 1. dijkstra - recorded from Dijkstra on a 1500 x 1500 road-like grid (192. Dijkshtra's Algorithm Code.cpp),
+//               every relaxation of a vertex already in the queue is a decrease
+// 2. hold     - event queue (scheduler) : 2^20 events, then 10^7 times pop the next event and schedule a new one
+//               at its time + random delay (monotone keys, no decrease)
+// 3. top-k    - 146. Finding Cabs style : 10^7 random keys stream by, the heap keeps the 2^16 largest
+//               (not monotone, the radix heap sits this one out)
+// Queues without decrease_key (std::priority_queue, KeyedDaryHeap, RadixHeap) push a duplicate and skip stale
+// entries when popped (a stale entry has a key other than the current key of its id).
+// Every queue must produce the same checksum of the popped key sequence.
+// Before that, PairingHeap erase / meld (not in the traces) are checked against a multiset.
+
+// Plugging in a queue : replay<Queue> takes any min queue with the interface of the heap templates,
+//     Queue();                                // ids grow as they are pushed
+//     void push(int id, unsigned key);
+//     int top_id();  unsigned top_key();  void pop();  bool empty();
+//     void decrease_key(int id, unsigned key);    // optional, id is in the queue, key is smaller than its current one
+// and gets one replay<Queue>(...) line in replayAll. set and std::priority_queue get the same interface below.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "DaryHeap_Template"
+#include "PairingHeap_Template"
+#include "RadixHeap_Template"
+#include "IndexedHeap_Template"
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+enum OpType : char { PUSH, DECREASE, POP };
+
+struct Op{
+    OpType type;
+    int id;
+    unsigned key;
+};
+
+struct Trace{
+    string name;
+    int ids;
+    bool monotone;
+    vector<Op> ops;
+};
+
+// ---------- baselines ----------
+
+using MinPQ = priority_queue<pair<unsigned,int>, vector<pair<unsigned,int>>, greater<pair<unsigned,int>>>;
+
+// the old 192 approach : set<pair<key, id>> with find + erase + insert
+class SetQueue{
+private:
+    set<pair<unsigned,int>> s;
+    vector<unsigned> key;
+
+public:
+    void push(int id, unsigned k){
+        if(id >= (int)key.size())
+            key.resize(max(id + 1, 2 * (int)key.size()));
+        s.insert({k, id});
+        key[id] = k;
+    }
+    void decrease_key(int id, unsigned k){
+        s.erase({key[id], id});
+        push(id, k);
+    }
+    int top_id() const{ return s.begin()->second; }
+    unsigned top_key() const{ return s.begin()->first; }
+    void pop(){ s.erase(s.begin()); }
+    bool empty() const{ return s.empty(); }
+};
+
+class StdQueue{
+private:
+    MinPQ pq;
+
+public:
+    void push(int id, unsigned k){ pq.push({k, id}); }
+    int top_id() const{ return pq.top().second; }
+    unsigned top_key() const{ return pq.top().first; }
+    void pop(){ pq.pop(); }
+    bool empty() const{ return pq.empty(); }
+};
+
+template<typename Queue, typename = void>
+struct hasDecreaseKey : false_type{};
+
+template<typename Queue>
+struct hasDecreaseKey<Queue, void_t<decltype(declval<Queue&>().decrease_key(0, 0u))>> : true_type{};
+
+// ---------- traces ----------
+
+Trace dijkstraTrace(mt19937& rng, int side){
+    int V = side * side;
+    vector<vector<pair<int,int>>> adj(V);
+    auto addEdge = [&](int u, int v, int wt){
+        adj[u].push_back({wt, v});
+        adj[v].push_back({wt, u});
+    };
+    for(int r = 0; r < side; r++)
+        for(int c = 0; c < side; c++){
+            int u = r * side + c;
+            if(c + 1 < side)
+                addEdge(u, u + 1, rng() % 1000 + 1);
+            if(r + 1 < side)
+                addEdge(u, u + side, rng() % 1000 + 1);
+            if(rng() % 64 == 0)
+                addEdge(u, rng() % V, rng() % 1000000 + 1000000);
+        }
+
+    Trace t{"dijkstra", V, true, {}};
+    vector<unsigned> dist(V, UINT_MAX);
+    IndexedHeap<unsigned> pq(V);
+    int src = rng() % V;
+    dist[src] = 0;
+    pq.push(src, 0);
+    t.ops.push_back({PUSH, src, 0});
+    while(!pq.empty()){
+        int node = pq.top_id();
+        unsigned d = pq.top_key();
+        pq.pop();
+        t.ops.push_back({POP, -1, 0});
+        for(auto [wt, nbr] : adj[node])
+            if(d + wt < dist[nbr]){
+                dist[nbr] = d + wt;
+                t.ops.push_back({pq.contains(nbr) ? DECREASE : PUSH, nbr, dist[nbr]});
+                pq.push_or_decrease(nbr, dist[nbr]);
+            }
+    }
+    return t;
+}
+
+Trace holdTrace(mt19937& rng, int size, int steps){
+    Trace t{"hold", size + steps, true, {}};
+    MinPQ pq;
+    int next = 0;
+    for(int i = 0; i < size; i++){
+        unsigned k = rng() % 1000000;
+        t.ops.push_back({PUSH, next, k});
+        pq.push({k, next++});
+    }
+    for(int i = 0; i < steps; i++){
+        unsigned k = pq.top().first + rng() % 1000000;
+        pq.pop();
+        t.ops.push_back({POP, -1, 0});
+        t.ops.push_back({PUSH, next, k});
+        pq.push({k, next++});
+    }
+    return t;
+}
+
+Trace topKTrace(mt19937& rng, int n, int k){
+    Trace t{"top-k", n, false, {}};
+    for(int i = 0; i < n; i++){
+        t.ops.push_back({PUSH, i, (unsigned)rng()});
+        if(i >= k)
+            t.ops.push_back({POP, -1, 0});
+    }
+    return t;
+}
+
+// random push / decrease_key / erase / pop / meld of two pairing heaps against two multisets
+bool pairingCheck(mt19937& rng){
+    PairingHeap<unsigned> heap[2];
+    multiset<unsigned> s[2];
+    vector<pair<int, int>> live;        // id, heap
+    vector<unsigned> key;
+    for(int step = 0; step < 200000; step++){
+        int op = rng() % 16, h = rng() % 2;
+        if(op < 6 || live.empty()){
+            unsigned k = rng() % 100000;
+            int id = key.size();
+            key.push_back(k);
+            heap[h].push(id, k);
+            live.push_back({id, h});
+            s[h].insert(k);
+        }
+        else if(op < 10){
+            auto [id, w] = live[rng() % live.size()];
+            unsigned k = key[id] - min(key[id], (unsigned)(rng() % 1000));
+            s[w].erase(s[w].find(key[id]));
+            s[w].insert(k);
+            heap[w].decrease_key(id, k);
+            key[id] = k;
+            if(heap[w].key(id) != k)
+                return false;
+        }
+        else if(op < 12){
+            int i = rng() % live.size();
+            auto [id, w] = live[i];
+            s[w].erase(s[w].find(key[id]));
+            heap[w].erase(id);
+            if(heap[w].contains(id))
+                return false;
+            live[i] = live.back(), live.pop_back();
+        }
+        else if(op < 15){
+            if(heap[h].empty())
+                continue;
+            int id = heap[h].top_id();
+            if(heap[h].top_key() != *s[h].begin() || key[id] != heap[h].top_key())
+                return false;
+            for(int i = 0; i < (int)live.size(); i++)
+                if(live[i].first == id){
+                    live[i] = live.back(), live.pop_back();
+                    break;
+                }
+            s[h].erase(s[h].begin());
+            heap[h].pop();
+        }
+        else if(rng() % 64 == 0){
+            heap[h].meld(heap[!h]);
+            s[h].insert(s[!h].begin(), s[!h].end());
+            s[!h].clear();
+            for(auto& [id, w] : live)
+                w = h;
+        }
+        if(heap[0].size() != s[0].size() || heap[1].size() != s[1].size())
+            return false;
+    }
+    return true;
+}
+
+// ---------- replay ----------
+
+template<typename Queue>
+void replay(const char* name, const Trace& t){
+    // queues without decrease_key : cur[id] is the key id is in the queue with, NONE after its pop
+    constexpr bool lazy = !hasDecreaseKey<Queue>::value;
+    const unsigned NONE = UINT_MAX;
+    vector<unsigned> cur(lazy ? t.ids : 0, NONE);
+    unsigned long long checksum = 0;
+    double ms = timeIt([&]{
+        Queue heap;
+        for(auto& [type, id, key] : t.ops){
+            if(type == POP){
+                if constexpr(lazy){
+                    while(cur[heap.top_id()] != heap.top_key())
+                        heap.pop();
+                    cur[heap.top_id()] = NONE;
+                }
+                checksum = checksum * 31 + heap.top_key();
+                heap.pop();
+                continue;
+            }
+            if constexpr(lazy){
+                cur[id] = key;
+                heap.push(id, key);
+            }
+            else if(type == DECREASE)
+                heap.decrease_key(id, key);
+            else
+                heap.push(id, key);
+        }
+    });
+    cout<<"  "<<name<<" : "<<ms<<" ms, "<<ms * 1e6 / t.ops.size()<<" ns/op, checksum "<<checksum<<endl;
+}
+
+void replayAll(const Trace& t){
+    size_t pushes = 0, decreases = 0;
+    for(auto& op : t.ops)
+        pushes += op.type == PUSH, decreases += op.type == DECREASE;
+    cout<<t.name<<" : "<<t.ops.size()<<" ops ("<<pushes<<" push, "<<decreases<<" decrease)"<<endl;
+    replay<SetQueue>                    ("set<pair<key, id>>        ", t);
+    replay<StdQueue>                    ("std::priority_queue (lazy)", t);
+    replay<KeyedDaryHeap<unsigned, 2>>  ("KeyedDaryHeap<2> (lazy)   ", t);
+    replay<KeyedDaryHeap<unsigned, 4>>  ("KeyedDaryHeap<4> (lazy)   ", t);
+    replay<IndexedHeap<unsigned, 2>>    ("IndexedHeap<2>            ", t);
+    replay<IndexedHeap<unsigned, 4>>    ("IndexedHeap<4>            ", t);
+    replay<PairingHeap<unsigned>>       ("PairingHeap               ", t);
+    // RadixHeap needs monotone keys
+    if(t.monotone)
+        replay<RadixHeap<unsigned>>     ("RadixHeap (lazy)          ", t);
+}
+
+int main(int argc, char** argv){
+    double scale = argc > 1 ? atof(argv[1]) : 1;
+
+    mt19937 rng(12345);
+    bool ok = pairingCheck(rng);
+    cout<<"PairingHeap check against multiset : "<<(ok ? "OK" : "MISMATCH")<<endl;
+    if(!ok)
+        return 1;
+    replayAll(dijkstraTrace(rng, max(2, (int)(1500 * sqrt(scale)))));
+    replayAll(holdTrace(rng, max(1, (int)((1 << 20) * scale)), max(1, (int)(10000000 * scale))));
+    replayAll(topKTrace(rng, max(2, (int)(10000000 * scale)), max(1, (int)((1 << 16) * scale))));
+
+    return 0;
+}
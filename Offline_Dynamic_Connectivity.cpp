@@ -0,0 +1,143 @@
+// Offline Dynamic Connectivity - Segment Tree over Time + Rollback DSU
+
+/* Problem Statement :
+Given n vertices numbered 0 .. n - 1 (0-based) and q operations, each one of
+    + u v : add the edge (u, v)
+    - u v : remove the edge (u, v) (it is present)
+    ? u v : are u and v connected right now?
+answer all the connectivity queries. */
+
+// Concept Used -> Every edge is alive during some interval [added, removed) of operation indices.
+// That interval is split into O(log q) nodes of a segment tree built over the operation indices.
+// A DFS over the segment tree unions the edges stored at a node on the way down and rolls them back
+// on the way up, so at leaf t the DSU holds exactly the edges alive at time t.
+
+// Time Complexity = O(q * log q * log n) in total => O(log^2) per operation
+// Space Complexity = O(n + q * log q)
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "DSU_Rollback_Template"
+
+class OfflineDynamicConnectivity{
+private:
+    vector<array<int,3>> ops;                 // {type, u, v}, type : 0 add, 1 remove, 2 query
+    vector<vector<pair<int,int>>> st;         // edges alive over the whole segment of each node
+    vector<bool> answers;
+    RollbackDisjointSetUnion<int> dsu;
+
+    void addInterval(int si, int ss, int se, int qs, int qe, const pair<int,int>& e){
+        if(qe < ss || se < qs)
+            return;
+        if(ss >= qs && se <= qe){
+            st[si].push_back(e);
+            return;
+        }
+        int mid = ss + (se - ss) / 2;
+        addInterval(2 * si, ss, mid, qs, qe, e);
+        addInterval(2 * si + 1, mid + 1, se, qs, qe, e);
+    }
+
+    void dfs(int si, int ss, int se){
+        size_t snap = dsu.snapshot();
+        for(auto& [u, v] : st[si])
+            dsu._union(u, v);
+
+        if(ss == se){
+            if(ops[ss][0] == 2)
+                answers[ss] = dsu.same(ops[ss][1], ops[ss][2]);
+        }
+        else{
+            int mid = ss + (se - ss) / 2;
+            dfs(2 * si, ss, mid);
+            dfs(2 * si + 1, mid + 1, se);
+        }
+
+        dsu.rollback(snap);
+    }
+
+public:
+    // vertices are 0 .. n - 1
+    OfflineDynamicConnectivity(int n) : dsu(n){}
+
+    void addEdge(int u, int v){
+        ops.push_back({0, u, v});
+    }
+
+    void removeEdge(int u, int v){
+        ops.push_back({1, u, v});
+    }
+
+    void connected(int u, int v){
+        ops.push_back({2, u, v});
+    }
+
+    // Returns the answer of every connected() call, in the order they were made
+    vector<bool> solve(){
+        int q = ops.size();
+        if(q == 0)
+            return {};
+
+        st.assign(4 * q, {});
+        answers.assign(q, false);
+
+        // Parallel edges are allowed, so keep a stack of start times per edge
+        map<pair<int,int>, vector<int>> open;
+        for(int t = 0; t < q; t++){
+            auto [type, u, v] = ops[t];
+            if(u > v)
+                swap(u, v);
+            if(type == 0){
+                open[{u, v}].push_back(t);
+            }
+            else if(type == 1){
+                auto it = open.find({u, v});
+                if(it == open.end() || it->second.empty())
+                    continue;
+                int start = it->second.back();
+                it->second.pop_back();
+                // alive for the operations strictly between the add and the remove
+                if(start + 1 <= t - 1)
+                    addInterval(1, 0, q - 1, start + 1, t - 1, {u, v});
+            }
+        }
+        for(auto& [e, starts] : open)
+            for(int start : starts)
+                if(start + 1 <= q - 1)
+                    addInterval(1, 0, q - 1, start + 1, q - 1, e);
+
+        dfs(1, 0, q - 1);
+
+        vector<bool> res;
+        for(int t = 0; t < q; t++)
+            if(ops[t][0] == 2)
+                res.push_back(answers[t]);
+        return res;
+    }
+};
+
+int main(){
+    ios_base::sync_with_stdio(false), cin.tie(NULL);
+
+    int n, q;
+    cin >> n >> q;
+
+    OfflineDynamicConnectivity odc(n);
+    while(q--){
+        char type;
+        int u, v;
+        cin >> type >> u >> v;
+        if(type == '+')
+            odc.addEdge(u, v);
+        else if(type == '-')
+            odc.removeEdge(u, v);
+        else
+            odc.connected(u, v);
+    }
+
+    for(bool ans : odc.solve())
+        cout << (ans ? "YES" : "NO") << '\n';
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+// Benchmark : FenwickTree (FenwickTree_Template) vs the pair<int,int> segment tree of help-ashu.cpp
+// Usage : ./FenwickTree_Benchmark [n] [q]     (default n = 10^6, q = 10^7)
+
+// Same operations as help-ashu : 0 i x => ar[i] = x, 1 l r => number of even values in [l, r], 2 l r => odd values.
+// The Fenwick tree only counts odd values, even = (r - l + 1) - odd. Checksums must match.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "FenwickTree_Template"
+
+vector<int> ar;
+// {odd, even}
+vector<pair<int,int>> st;
+
+void build(int si, int ss, int se){
+	if(ss==se){
+		if(ar[ss]%2 ==1 )
+			st[si]={1,0};
+		else
+			st[si]={0,1};
+		return;
+	}
+
+	int mid = ss +(se-ss)/2;
+
+	build(2*si, ss, mid);
+	build(2*si+1, mid+1, se);
+
+	st[si].first=st[2*si].first + st[2*si+1].first;
+	st[si].second=st[2*si].second + st[2*si+1].second;
+}
+
+void update(int si, int ss, int se, int qi, int newVal){
+	if(ss==se){
+		if(ar[ss]%2 == 1)
+			st[si]={0,1};
+		else
+			st[si]={1,0};
+
+		ar[ss]=newVal;
+		return;
+	}
+
+	int mid = ss +(se-ss)/2;
+
+	if(qi<=mid)
+		update(2*si, ss, mid, qi, newVal);
+	else
+		update(2*si+1, mid+1, se, qi, newVal);
+
+	st[si].first=st[2*si].first + st[2*si+1].first;
+	st[si].second=st[2*si].second + st[2*si+1].second;
+}
+
+int getEven(int si, int ss, int se, int l, int r){
+	if(ss>r || se<l)
+		return 0;
+	if(ss>=l && se<=r)
+		return st[si].second;
+
+	int mid = ss +(se-ss)/2;
+	return getEven(2*si,ss,mid,l,r) + getEven(2*si+1,mid+1,se,l,r);
+}
+
+int getOdd(int si, int ss, int se, int l, int r){
+	if(ss>r || se<l)
+		return 0;
+	if(ss>=l && se<=r)
+		return st[si].first;
+
+	int mid = ss +(se-ss)/2;
+	return getOdd(2*si,ss,mid,l,r) + getOdd(2*si+1,mid+1,se,l,r);
+}
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int q = argc > 2 ? atoi(argv[2]) : 10000000;
+
+    mt19937 rng(12345);
+    vector<int> input(n);
+    for(int& x : input)
+        x = rng() % 1000000000;
+
+    vector<array<int,3>> ops(q);
+    for(auto& [code, l, r] : ops){
+        code = rng() % 3;
+        if(code == 0)
+            l = rng() % n, r = rng() % 1000000000;
+        else{
+            l = rng() % n, r = rng() % n;
+            if(l > r)
+                swap(l, r);
+        }
+    }
+
+    cout<<"n = "<<n<<", q = "<<q<<endl;
+
+    long long c1 = 0;
+    ar.assign(n + 1, 0);
+    st.assign(4 * (n + 1), {0, 0});
+    copy(input.begin(), input.end(), ar.begin() + 1);
+    build(1, 1, n);
+    double t1 = timeIt([&]{
+        for(auto& [code, l, r] : ops){
+            if(code == 0){
+                if((ar[l + 1] % 2) != r % 2)
+                    update(1, 1, n, l + 1, r);
+            }
+            else if(code == 1)
+                c1 += getEven(1, 1, n, l + 1, r + 1);
+            else
+                c1 += getOdd(1, 1, n, l + 1, r + 1);
+        }
+    });
+
+    long long c2 = 0;
+    vector<int> cur = input, odd(n);
+    for(int i = 0; i < n; i++)
+        odd[i] = cur[i] & 1;
+    FenwickTree<int> bit(odd);
+    double t2 = timeIt([&]{
+        for(auto& [code, l, r] : ops){
+            if(code == 0){
+                if((cur[l] & 1) != (r & 1))
+                    bit.add(l, (r & 1) ? 1 : -1);
+                cur[l] = r;
+            }
+            else if(code == 1)
+                c2 += (r - l + 1) - bit.query(l, r);
+            else
+                c2 += bit.query(l, r);
+        }
+    });
+
+    cout<<"segment tree : "<<t1 / q * 1e6<<" ns/op, memory "<<st.size() * sizeof(pair<int,int>) / (1 << 20)<<" MB"<<endl;
+    cout<<"fenwick tree : "<<t2 / q * 1e6<<" ns/op, memory "<<bit.memoryBytes() / (1 << 20)<<" MB"<<endl;
+    cout<<(c1 == c2 ? "checksums match" : "MISMATCH")<<endl;
+
+    return 0;
+}
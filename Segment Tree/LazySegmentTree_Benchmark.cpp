@@ -0,0 +1,188 @@
+// Benchmark : LazySegmentTree<Monoid, Tag> (LazySegmentTree_Template) on 10^7 mixed operations
+// Usage : ./LazySegmentTree_Benchmark [n] [ops]     (default n = 10^6, ops = 10^7)
+
+// 1. range add + range sum  : against the recursive lazy tree of Lazy-Propagation(Range Updates).cpp
+//                             (long long and vectors so n can be chosen at runtime), checksums must match
+// 2. range assign + add     : AssignAddTag
+// 3. range affine mod p     : AffineTag
+// Half of the operations are updates and half are queries, on random ranges.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "LazySegmentTree_Template"
+
+vector<long long> ar, st, lazy;
+
+void build(int si, int ss, int se){
+    if(ss==se){
+        st[si] = ar[ss];
+        return;
+    }
+
+    int mid = ss + (se - ss) / 2;
+
+    build(2*si, ss, mid);
+    build(2*si+1, mid + 1, se);
+
+    st[si] = st[2 * si] + st[2 * si + 1];
+}
+
+long long query(int si, int ss, int se, int qs, int qe){
+
+    if (lazy[si] != 0){
+        long long dx = lazy[si];
+        lazy[si] = 0;
+        st[si] += dx * (se - ss + 1);
+
+        if(ss!=se){
+            lazy[2 * si] += dx;
+            lazy[2 * si + 1] += dx;
+        }
+    }
+
+    if (ss > qe || se < qs)
+            return 0;
+    if(ss>=qs && se<=qe)
+        return st[si];
+
+    int mid = ss + (se - ss) / 2;
+
+    long long left = query(2 * si, ss, mid, qs, qe);
+    long long right = query(2 * si + 1, mid+1, se, qs, qe);
+
+    return left + right;
+}
+
+void update(int si, int ss, int se, int qs, int qe, long long val){
+
+    if (lazy[si] != 0){
+        long long dx = lazy[si];
+        lazy[si] = 0;
+        st[si] += dx * (se - ss + 1);
+
+        if(ss!=se){
+            lazy[2 * si] += dx;
+            lazy[2 * si + 1] += dx;
+        }
+    }
+
+    if (ss > qe || se < qs)
+            return;
+
+    if(ss>=qs && se<=qe){
+        long long dx = val * (se - ss + 1);
+        st[si] += dx;
+
+        if(ss!=se){
+            lazy[2 * si] += val;
+            lazy[2 * si + 1] += val;
+        }
+        return;
+    }
+
+    int mid = ss + (se - ss) / 2;
+
+    update(2 * si, ss, mid, qs, qe, val);
+    update(2 * si + 1, mid + 1, se, qs, qe, val);
+
+    st[si] = st[2 * si] + st[2 * si + 1];
+}
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+struct Op{
+    bool isUpdate;
+    int l, r;
+    long long x, y;
+};
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int ops = argc > 2 ? atoi(argv[2]) : 10000000;
+    const long long P = 998244353;
+
+    mt19937 rng(12345);
+    vector<long long> input(n);
+    for(auto& x : input)
+        x = rng() % 1000;
+
+    vector<Op> trace(ops);
+    for(auto& op : trace){
+        op.isUpdate = rng() & 1;
+        op.l = rng() % n, op.r = rng() % n;
+        if(op.l > op.r)
+            swap(op.l, op.r);
+        op.x = rng() % 1000, op.y = rng() % 1000;
+    }
+
+    vector<SumLen<long long>> leaves(n);
+    for(int i = 0; i < n; i++)
+        leaves[i] = {input[i], 1};
+
+    cout<<"n = "<<n<<", ops = "<<ops<<endl;
+    auto mops = [&](double ms){ return ops / ms / 1000; };
+
+    // 1. range add + range sum
+    long long c1 = 0, c2 = 0;
+    ar.assign(n + 1, 0);
+    st.assign(4 * (n + 1), 0);
+    lazy.assign(4 * (n + 1), 0);
+    copy(input.begin(), input.end(), ar.begin() + 1);
+    build(1, 1, n);
+    double tRecursive = timeIt([&]{
+        for(auto& op : trace){
+            if(op.isUpdate)
+                update(1, 1, n, op.l + 1, op.r + 1, op.x);
+            else
+                c1 += query(1, 1, n, op.l + 1, op.r + 1);
+        }
+    });
+
+    LazySegmentTree<SumLenMonoid<long long>, AddTag<long long>> addTree(leaves);
+    double tAdd = timeIt([&]{
+        for(auto& op : trace){
+            if(op.isUpdate)
+                addTree.update(op.l, op.r, op.x);
+            else
+                c2 += addTree.query(op.l, op.r).sum;
+        }
+    });
+    cout<<"range add/sum   : recursive "<<mops(tRecursive)<<" M ops/s, template "<<mops(tAdd)<<" M ops/s"
+        <<(c1 == c2 ? "" : "  (MISMATCH)")<<endl;
+
+    // 2. range assign + range add
+    long long c3 = 0;
+    using AA = AssignAddTag<long long>;
+    LazySegmentTree<SumLenMonoid<long long>, AA> assignTree(leaves);
+    double tAssign = timeIt([&]{
+        for(auto& op : trace){
+            if(op.isUpdate)
+                assignTree.update(op.l, op.r, (op.y & 1) ? AA::makeAssign(op.x) : AA::makeAdd(op.x));
+            else
+                c3 += assignTree.query(op.l, op.r).sum;
+        }
+    });
+    cout<<"assign+add/sum  : template "<<mops(tAssign)<<" M ops/s (checksum "<<c3<<")"<<endl;
+
+    // 3. range affine mod P
+    long long c4 = 0;
+    LazySegmentTree<SumLenMonoid<long long, P>, AffineTag<long long, P>> affineTree(leaves);
+    double tAffine = timeIt([&]{
+        for(auto& op : trace){
+            if(op.isUpdate)
+                affineTree.update(op.l, op.r, {op.x, op.y});
+            else
+                c4 = (c4 + affineTree.query(op.l, op.r).sum) % P;
+        }
+    });
+    cout<<"affine/sum mod p: template "<<mops(tAffine)<<" M ops/s (checksum "<<c4<<")"<<endl;
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Randomized differential test : MaxSubarraySegmentTree (MaxSubarraySegmentTree_Template) vs a brute force array
+// Usage : ./MaxSubarraySegmentTree_Stress_Test [rounds] [seed]     (default 2000 rounds, seed 1)
+// Prints the first operation that disagrees and exits with 1, otherwise prints OK
+
+// A query is accepted when its sum equals Kadane's answer on [l, r] and the returned [i, j]
+// lies inside [l, r] and really sums to it. Small value ranges make the add thresholds flip often,
+// then one large round (GSS3 sized) checks the kinetic recursion stays cheap.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "MaxSubarraySegmentTree_Template"
+
+long long kadane(const vector<long long>& ar, int l, int r){
+    long long best = ar[l], cur = ar[l];
+    for(int i = l + 1; i <= r; i++){
+        cur = max(ar[i], cur + ar[i]);
+        best = max(best, cur);
+    }
+    return best;
+}
+
+bool runRound(mt19937& rng, int n, int ops, long long range){
+    vector<long long> ar(n);
+    for(auto& x : ar)
+        x = (long long)(rng() % (2 * range + 1)) - range;
+
+    MaxSubarraySegmentTree<long long> tree(ar);
+
+    for(int op = 0; op < ops; op++){
+        int type = rng() % 4;
+        int l = rng() % n, r = rng() % n;
+        if(l > r)
+            swap(l, r);
+        long long x = (long long)(rng() % (2 * range + 1)) - range;
+
+        if(type == 0){
+            tree.assign(l, r, x);
+            for(int i = l; i <= r; i++)
+                ar[i] = x;
+            continue;
+        }
+        else if(type == 1){
+            tree.add(l, r, x);
+            for(int i = l; i <= r; i++)
+                ar[i] += x;
+            continue;
+        }
+
+        auto got = tree.query(l, r);
+        long long expected = kadane(ar, l, r);
+        bool ok = got.sum == expected && l <= got.l && got.l <= got.r && got.r <= r
+               && accumulate(ar.begin() + got.l, ar.begin() + got.r + 1, 0LL) == got.sum;
+        if(!ok){
+            cout<<"MISMATCH n = "<<n<<" op "<<op<<" : query("<<l<<", "<<r<<") = {"<<got.sum<<", "<<got.l<<", "
+                <<got.r<<"}, expected "<<expected<<endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv){
+    int rounds = argc > 1 ? atoi(argv[1]) : 2000;
+    int seed = argc > 2 ? atoi(argv[2]) : 1;
+
+    mt19937 rng(seed);
+    for(int round = 0; round < rounds; round++){
+        int n = rng() % 64 + 1;
+        if(!runRound(rng, n, 500, rng() % 2 ? 10 : 10000))
+            return 1;
+    }
+
+    auto start = chrono::steady_clock::now();
+    if(!runRound(rng, 50000, 50000, 10000))
+        return 1;
+    auto end = chrono::steady_clock::now();
+    cout<<"large round : "<<chrono::duration<double, milli>(end - start).count()<<" ms"<<endl;
+
+    cout<<"OK"<<endl;
+    return 0;
+}
@@ -0,0 +1,108 @@
+// Persistent Segment Tree (PersistentSegmentTree_Template) - versioned queries and k-th smallest in range
+// Usage : ./PersistentSegmentTree_Demo [n] [q]     (default n = 10^5, q = 10^5)
+
+// 1. Versioned point updates : every update branches from a random earlier version, every query hits a
+//    random version. Checked against full copies of the array kept per version (small n only).
+// 2. K-th smallest in ar[l..r] (SPOJ MKTHNUM) : version i holds counts of the compressed values of ar[0..i-1],
+//    the answer is kthDifference(l, r + 1, k). Checked against sorting the range (small n only).
+// Memory per version is printed for both.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "SegmentTree_Template"
+#include "PersistentSegmentTree_Template"
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    int q = argc > 2 ? atoi(argv[2]) : 100000;
+    bool check = (long long)n * q <= 100000000LL;
+
+    mt19937 rng(12345);
+    vector<long long> ar(n);
+    for(auto& x : ar)
+        x = rng() % 1000000000;
+
+    cout<<"n = "<<n<<", q = "<<q<<(check ? " (checked against brute force)" : "")<<endl;
+
+    // 1. Versioned sums
+    PersistentSegmentTree<SumMonoid<long long>> tree(ar, q);
+    vector<vector<long long>> copies;
+    if(check)
+        copies.push_back(ar);
+    bool ok = true;
+    long long checksum = 0;
+    double t = timeIt([&]{
+        for(int op = 0; op < q; op++){
+            int version = rng() % tree.versions();
+            int l = rng() % n, r = rng() % n;
+            if(l > r)
+                swap(l, r);
+            if(op & 1){
+                long long val = rng() % 1000000000;
+                tree.update(version, l, val);
+                if(check){
+                    copies.push_back(copies[version]);
+                    copies.back()[l] = val;
+                }
+            }
+            else{
+                long long got = tree.query(version, l, r);
+                checksum += got;
+                if(check && got != accumulate(copies[version].begin() + l, copies[version].begin() + r + 1, 0LL))
+                    ok = false;
+            }
+        }
+    });
+    cout<<"versioned sums : "<<tree.versions()<<" versions in "<<t<<" ms (checksum "<<checksum<<")"
+        <<(ok ? "" : "  MISMATCH")<<endl;
+    cout<<"  version 0 : "<<tree.nodesOf(0)<<" nodes, "<<tree.memoryBytesOf(0)<<" bytes"<<endl;
+    if(tree.versions() > 1)
+        cout<<"  version 1 : "<<tree.nodesOf(1)<<" nodes, "<<tree.memoryBytesOf(1)<<" bytes (one root to leaf path)"<<endl;
+    cout<<"  total     : "<<tree.memoryBytes()<<" bytes vs "<<(size_t)tree.versions() * n * sizeof(long long)
+        <<" bytes for a full copy per version"<<endl;
+
+    // 2. K-th smallest by version differencing
+    vector<long long> sorted = ar;
+    sort(sorted.begin(), sorted.end());
+    sorted.erase(unique(sorted.begin(), sorted.end()), sorted.end());
+    int m = sorted.size();
+
+    PersistentSegmentTree<SumMonoid<int>> counts(vector<int>(m, 0), n);
+    vector<int> cnt(m, 0);
+    for(int i = 0; i < n; i++){
+        int c = lower_bound(sorted.begin(), sorted.end(), ar[i]) - sorted.begin();
+        counts.update(i, c, ++cnt[c]);      // version i + 1 = counts of ar[0..i]
+    }
+
+    bool kthOk = true;
+    checksum = 0;
+    t = timeIt([&]{
+        for(int op = 0; op < q; op++){
+            int l = rng() % n, r = rng() % n;
+            if(l > r)
+                swap(l, r);
+            int k = rng() % (r - l + 1);
+            long long got = sorted[counts.kthDifference(l, r + 1, k)];
+            checksum += got;
+            if(check){
+                vector<long long> range(ar.begin() + l, ar.begin() + r + 1);
+                nth_element(range.begin(), range.begin() + k, range.end());
+                if(range[k] != got)
+                    kthOk = false;
+            }
+        }
+    });
+    cout<<"k-th smallest  : "<<q<<" queries in "<<t<<" ms (checksum "<<checksum<<")"<<(kthOk ? "" : "  MISMATCH")<<endl;
+    cout<<"  version 0 : "<<counts.memoryBytesOf(0)<<" bytes, each prefix version : "<<counts.memoryBytesOf(1)<<" bytes"<<endl;
+
+    return ok && kthOk ? 0 : 1;
+}
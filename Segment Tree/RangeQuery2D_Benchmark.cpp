@@ -0,0 +1,127 @@
+// Benchmark : 2D rectangle queries (RangeQuery2D_Template) on a 4096 x 4096 grid
+// Usage : ./RangeQuery2D_Benchmark [n] [q]     (default n = 4096, q = 10^6)
+
+// Static sum : PrefixSum2D vs SegmentTree2D<SumMonoid>
+// Static min : SparseTable2D vs SegmentTree2D<MinMonoid>
+// Updates    : SegmentTree2D point updates interleaved with rectangle queries
+// Every pair answers the same random rectangles, the checksums must match. A small grid is also
+// checked against brute force first.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "SegmentTree_Template"
+#include "RangeQuery2D_Template"
+
+#define INF 1000000000
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+struct Rect{
+    int r1, c1, r2, c2;
+};
+
+vector<Rect> randomRects(mt19937& rng, int n, int q){
+    vector<Rect> res(q);
+    for(auto& [r1, c1, r2, c2] : res){
+        r1 = rng() % n, r2 = rng() % n, c1 = rng() % n, c2 = rng() % n;
+        if(r1 > r2)
+            swap(r1, r2);
+        if(c1 > c2)
+            swap(c1, c2);
+    }
+    return res;
+}
+
+bool bruteCheck(mt19937& rng){
+    int n = 37;
+    vector<vector<long long>> grid(n, vector<long long>(n));
+    for(auto& row : grid)
+        for(auto& x : row)
+            x = rng() % INF;
+    PrefixSum2D<long long> prefix(grid);
+    SparseTable2D<long long> sparse(grid);
+    SegmentTree2D<SumMonoid<long long>> sums(grid);
+    SegmentTree2D<MinMonoid<long long>> mins(grid);
+    for(auto& [r1, c1, r2, c2] : randomRects(rng, n, 20000)){
+        long long s = 0, mn = LLONG_MAX;
+        for(int i = r1; i <= r2; i++)
+            for(int j = c1; j <= c2; j++)
+                s += grid[i][j], mn = min(mn, grid[i][j]);
+        if(prefix.query(r1, c1, r2, c2) != s || sums.query(r1, c1, r2, c2) != s
+           || sparse.query(r1, c1, r2, c2) != mn || mins.query(r1, c1, r2, c2) != mn)
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 4096;
+    int q = argc > 2 ? atoi(argv[2]) : 1000000;
+
+    mt19937 rng(12345);
+    if(!bruteCheck(rng)){
+        cout<<"MISMATCH against brute force"<<endl;
+        return 1;
+    }
+    cout<<"brute force check : OK"<<endl;
+
+    vector<vector<int>> grid(n, vector<int>(n));
+    for(auto& row : grid)
+        for(auto& x : row)
+            x = rng() % INF;
+    vector<Rect> rects = randomRects(rng, n, q);
+    cout<<"grid "<<n<<" x "<<n<<", q = "<<q<<endl;
+
+    auto report = [&](const char* name, double tBuild, double tQuery, size_t bytes){
+        cout<<name<<" : build "<<tBuild<<" ms, "<<tQuery * 1e6 / q<<" ns/query, memory "<<bytes / (1 << 20)<<" MB"<<endl;
+    };
+
+    // static sum
+    {
+        vector<vector<long long>> wide(n, vector<long long>(n));
+        for(int i = 0; i < n; i++)
+            copy(grid[i].begin(), grid[i].end(), wide[i].begin());
+        long long c1 = 0, c2 = 0;
+        PrefixSum2D<long long> prefix;
+        SegmentTree2D<SumMonoid<long long>> tree;
+        double b1 = timeIt([&]{ prefix = PrefixSum2D<long long>(wide); });
+        double t1 = timeIt([&]{ for(auto& [r1, c1_, r2, c2_] : rects) c1 += prefix.query(r1, c1_, r2, c2_); });
+        double b2 = timeIt([&]{ tree = SegmentTree2D<SumMonoid<long long>>(wide); });
+        double t2 = timeIt([&]{ for(auto& [r1, c1_, r2, c2_] : rects) c2 += tree.query(r1, c1_, r2, c2_); });
+        report("sum prefix sums    ", b1, t1, prefix.memoryBytes());
+        report("sum segment tree 2D", b2, t2, tree.memoryBytes());
+        cout<<(c1 == c2 ? "checksums match" : "MISMATCH")<<endl;
+    }
+
+    // static min, then updates on the segment tree
+    {
+        long long c1 = 0, c2 = 0;
+        SparseTable2D<int> sparse;
+        SegmentTree2D<MinMonoid<int>> tree;
+        double b1 = timeIt([&]{ sparse = SparseTable2D<int>(grid); });
+        double t1 = timeIt([&]{ for(auto& [r1, c1_, r2, c2_] : rects) c1 += sparse.query(r1, c1_, r2, c2_); });
+        double b2 = timeIt([&]{ tree = SegmentTree2D<MinMonoid<int>>(grid); });
+        double t2 = timeIt([&]{ for(auto& [r1, c1_, r2, c2_] : rects) c2 += tree.query(r1, c1_, r2, c2_); });
+        report("min sparse table 2D", b1, t1, sparse.memoryBytes());
+        report("min segment tree 2D", b2, t2, tree.memoryBytes());
+        cout<<(c1 == c2 ? "checksums match" : "MISMATCH")<<endl;
+
+        long long c3 = 0;
+        double t3 = timeIt([&]{
+            for(auto& [r1, c1_, r2, c2_] : rects){
+                tree.update(r1, c2_, rng() % INF);
+                c3 += tree.query(r1, c1_, r2, c2_);
+            }
+        });
+        cout<<"min segment tree 2D : update + query "<<t3 * 1e6 / q<<" ns/pair (checksum "<<c3<<")"<<endl;
+    }
+
+    return 0;
+}
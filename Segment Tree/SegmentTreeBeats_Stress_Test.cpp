@@ -0,0 +1,91 @@
+// Randomized differential test : SegmentTreeBeats (SegmentTreeBeats_Template) vs a brute force array
+// Usage : ./SegmentTreeBeats_Stress_Test [rounds] [seed]     (default 2000 rounds, seed 1)
+// Prints the first operation that disagrees and exits with 1, otherwise prints OK
+
+// Every round uses a new small array (so the ranges overlap a lot and chmin/chmax keep hitting
+// the max2/min2 boundaries), then one large round checks the amortized bound doesn't blow up.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "SegmentTreeBeats_Template"
+
+bool runRound(mt19937& rng, int n, int ops, long long range){
+    vector<long long> ar(n);
+    for(auto& x : ar)
+        x = (long long)(rng() % (2 * range + 1)) - range;
+
+    SegmentTreeBeats<long long> tree(ar);
+
+    for(int op = 0; op < ops; op++){
+        int type = rng() % 6;
+        int l = rng() % n, r = rng() % n;
+        if(l > r)
+            swap(l, r);
+        long long x = (long long)(rng() % (2 * range + 1)) - range;
+
+        long long expected = 0, got = 0;
+        string name;
+        if(type == 0){
+            tree.chmin(l, r, x);
+            for(int i = l; i <= r; i++)
+                ar[i] = min(ar[i], x);
+            continue;
+        }
+        else if(type == 1){
+            tree.chmax(l, r, x);
+            for(int i = l; i <= r; i++)
+                ar[i] = max(ar[i], x);
+            continue;
+        }
+        else if(type == 2){
+            tree.add(l, r, x);
+            for(int i = l; i <= r; i++)
+                ar[i] += x;
+            continue;
+        }
+        else if(type == 3){
+            name = "sum";
+            got = tree.querySum(l, r);
+            expected = accumulate(ar.begin() + l, ar.begin() + r + 1, 0LL);
+        }
+        else if(type == 4){
+            name = "max";
+            got = tree.queryMax(l, r);
+            expected = *max_element(ar.begin() + l, ar.begin() + r + 1);
+        }
+        else{
+            name = "min";
+            got = tree.queryMin(l, r);
+            expected = *min_element(ar.begin() + l, ar.begin() + r + 1);
+        }
+
+        if(got != expected){
+            cout<<"MISMATCH n = "<<n<<" op "<<op<<" : "<<name<<"("<<l<<", "<<r<<") = "<<got
+                <<", expected "<<expected<<endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv){
+    int rounds = argc > 1 ? atoi(argv[1]) : 2000;
+    int seed = argc > 2 ? atoi(argv[2]) : 1;
+
+    mt19937 rng(seed);
+    for(int round = 0; round < rounds; round++){
+        int n = rng() % 64 + 1;
+        if(!runRound(rng, n, 500, rng() % 2 ? 10 : 1000000000))
+            return 1;
+    }
+
+    auto start = chrono::steady_clock::now();
+    if(!runRound(rng, 2000, 20000, 1000000000))
+        return 1;
+    auto end = chrono::steady_clock::now();
+    cout<<"large round : "<<chrono::duration<double, milli>(end - start).count()<<" ms"<<endl;
+
+    cout<<"OK"<<endl;
+    return 0;
+}
@@ -0,0 +1,159 @@
+// Benchmark : SegmentTree::queryBatch (SegmentTree_Template) vs answering queries one at a time
+// Usage : ./SegmentTree_Batch_Benchmark [n] [q]     (default n = 10^7, q = 10^7)
+
+// 1. RMQSQ : recursive query(1, 1, n, l, r) per query, bottom up query(l, r) per query, queryBatch
+// 2. GSS3  : same three for the max subarray node of GSS3 - Can you answer these queries III.cpp.
+//            GSS3's own query returns left + right of the children's maxisum, which is not the max subarray
+//            of a range crossing mid, so the recursive side here returns the merged node instead.
+// All answers are compared with the recursive ones.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "SegmentTree_Template"
+
+#define INF 1000000000
+
+struct node
+{
+    long long sum;
+    long long maxlsum;
+    long long maxrsum;
+    long long maxisum;
+};
+
+// a range that is never queried is the identity : it never wins a max and adds nothing to a sum
+struct GSSMonoid{
+    using T = node;
+    static T identity(){ return {0, -INF, -INF, -INF}; }
+    static T combine(const T& a, const T& b){
+        return {a.sum + b.sum,
+                max(a.maxlsum, a.sum + b.maxlsum),
+                max(a.maxrsum + b.sum, b.maxrsum),
+                max(max(a.maxisum, b.maxisum), a.maxrsum + b.maxlsum)};
+    }
+};
+
+vector<int> ar, st;
+vector<node> gst;
+
+void build(int si, int ss, int se){
+    if(ss==se){
+        st[si]=ar[ss];
+        gst[si] = {ar[ss], ar[ss], ar[ss], ar[ss]};
+        return;
+    }
+
+    int mid = ss + (se-ss)/2;
+
+    build(2*si, ss, mid);
+    build(2*si+1,mid+1, se);
+
+    st[si]= min(st[2*si],st[2*si+1]);
+    gst[si] = GSSMonoid::combine(gst[2*si], gst[2*si+1]);
+}
+
+int query(int si, int ss, int se, int qs, int qe){
+
+    if(qe<ss || qs>se)
+        return INF;
+
+    if(ss>=qs && se<=qe)
+        return st[si];
+
+    int mid = ss + (se-ss)/2;
+
+    int left = query(2*si, ss, mid, qs, qe);
+    int right = query(2*si+1, mid+1, se, qs, qe);
+
+    return min(left , right) ;
+}
+
+node queryGSS(int si, int ss, int se, int qs, int qe){
+    if(ss>=qs && se<=qe)
+        return gst[si];
+
+    int mid = ss + (se-ss)/2;
+
+    if(qe <= mid)
+        return queryGSS(2*si, ss, mid, qs, qe);
+    if(qs > mid)
+        return queryGSS(2*si+1, mid+1, se, qs, qe);
+    return GSSMonoid::combine(queryGSS(2*si, ss, mid, qs, qe), queryGSS(2*si+1, mid+1, se, qs, qe));
+}
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    int q = argc > 2 ? atoi(argv[2]) : 10000000;
+
+    mt19937 rng(12345);
+    vector<int> input(n);
+    for(int& x : input)
+        x = int(rng() % 20001) - 10000;
+
+    vector<pair<int,int>> ranges(q);
+    for(auto& [l, r] : ranges){
+        l = rng() % n, r = rng() % n;
+        if(l > r)
+            swap(l, r);
+    }
+
+    cout<<"n = "<<n<<", q = "<<q<<endl;
+
+    ar.assign(n + 1, 0);
+    st.assign(4 * (n + 1), 0);
+    gst.assign(4 * (n + 1), GSSMonoid::identity());
+    copy(input.begin(), input.end(), ar.begin() + 1);
+    build(1, 1, n);
+
+    // 1. RMQSQ
+    {
+        vector<int> expected(q), single(q), batch;
+        double t1 = timeIt([&]{
+            for(int k = 0; k < q; k++)
+                expected[k] = query(1, 1, n, ranges[k].first + 1, ranges[k].second + 1);
+        });
+        SegmentTree<MinMonoid<int>> tree(input);
+        double t2 = timeIt([&]{
+            for(int k = 0; k < q; k++)
+                single[k] = tree.query(ranges[k].first, ranges[k].second);
+        });
+        double t3 = timeIt([&]{ batch = tree.queryBatch(ranges); });
+        cout<<"RMQSQ : recursive "<<t1<<" ms, bottom up "<<t2<<" ms, batch "<<t3<<" ms"
+            <<(expected == single && expected == batch ? "" : "  (MISMATCH)")<<endl;
+    }
+
+    // 2. GSS3
+    {
+        vector<long long> expected(q), single(q), batch(q);
+        double t1 = timeIt([&]{
+            for(int k = 0; k < q; k++)
+                expected[k] = queryGSS(1, 1, n, ranges[k].first + 1, ranges[k].second + 1).maxisum;
+        });
+        vector<node> leaves(n);
+        for(int i = 0; i < n; i++)
+            leaves[i] = {input[i], input[i], input[i], input[i]};
+        SegmentTree<GSSMonoid> tree(leaves);
+        double t2 = timeIt([&]{
+            for(int k = 0; k < q; k++)
+                single[k] = tree.query(ranges[k].first, ranges[k].second).maxisum;
+        });
+        double t3 = timeIt([&]{
+            vector<node> res = tree.queryBatch(ranges);
+            for(int k = 0; k < q; k++)
+                batch[k] = res[k].maxisum;
+        });
+        cout<<"GSS3  : recursive "<<t1<<" ms, bottom up "<<t2<<" ms, batch "<<t3<<" ms"
+            <<(expected == single && expected == batch ? "" : "  (MISMATCH)")<<endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+// Benchmark : SegmentTree<Monoid> (SegmentTree_Template) vs the recursive st[4*maxN] segment tree
+// Usage : ./SegmentTree_Benchmark [n] [ops]     (default n = 10^7, ops = 10^7)
+
+// Recursive side is the build/query of RMQSQ - Range Minimum Query.cpp and the update of
+// segment-tree-point-update.cpp, only with vectors so n can be chosen at runtime.
+// Both answer the same random range min queries and point updates, the checksums must match.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "SegmentTree_Template"
+
+#define INF 1000000000
+
+vector<int> ar, st;
+
+void build(int si, int ss, int se){
+    if(ss==se){
+        st[si]=ar[ss];
+        return;
+    }
+
+    int mid = ss + (se-ss)/2;
+
+    build(2*si, ss, mid);
+    build(2*si+1,mid+1, se);
+
+    st[si]= min(st[2*si],st[2*si+1]);
+}
+
+int query(int si, int ss, int se, int qs, int qe){
+
+    if(qe<ss || qs>se)
+        return INF;
+
+    if(ss>=qs && se<=qe)
+        return st[si];
+
+    int mid = ss + (se-ss)/2;
+
+    int left = query(2*si, ss, mid, qs, qe);
+    int right = query(2*si+1, mid+1, se, qs, qe);
+
+    return min(left , right) ;
+}
+
+void segment_tree_point_update(int si, int ss, int se, int qi){
+    if(ss==se){
+        st[si]=ar[ss];
+        return;
+    }
+
+    int mid = ss + (se-ss)/2;
+    if(qi<=mid)
+        segment_tree_point_update(2*si, ss, mid, qi);
+    else
+        segment_tree_point_update(2*si+1, mid+1, se, qi);
+
+    st[si] = min(st[2*si], st[2*si+1]);
+}
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    int ops = argc > 2 ? atoi(argv[2]) : 10000000;
+
+    mt19937 rng(12345);
+    vector<int> input(n);
+    for(int& x : input)
+        x = rng() % INF;
+
+    // {l, r} for queries, {i, val} for updates
+    vector<pair<int,int>> queries(ops), updates(ops);
+    for(auto& [l, r] : queries){
+        l = rng() % n, r = rng() % n;
+        if(l > r)
+            swap(l, r);
+    }
+    for(auto& [i, v] : updates)
+        i = rng() % n, v = rng() % INF;
+
+    cout<<"n = "<<n<<", ops = "<<ops<<endl;
+
+    // Recursive, 1-indexed
+    long long c1 = 0;
+    ar.assign(n + 1, 0);
+    st.assign(4 * (n + 1), 0);
+    copy(input.begin(), input.end(), ar.begin() + 1);
+    double tBuild1 = timeIt([&]{ build(1, 1, n); });
+    double tQuery1 = timeIt([&]{
+        for(auto& [l, r] : queries)
+            c1 += query(1, 1, n, l + 1, r + 1);
+    });
+    double tUpdate1 = timeIt([&]{
+        for(auto& [i, v] : updates){
+            ar[i + 1] = v;
+            segment_tree_point_update(1, 1, n, i + 1);
+        }
+    });
+    c1 += query(1, 1, n, 1, n);
+
+    // Bottom up, 0-indexed
+    long long c2 = 0;
+    SegmentTree<MinMonoid<int>> tree;
+    double tBuild2 = timeIt([&]{ tree = SegmentTree<MinMonoid<int>>(input); });
+    double tQuery2 = timeIt([&]{
+        for(auto& [l, r] : queries)
+            c2 += tree.query(l, r);
+    });
+    double tUpdate2 = timeIt([&]{
+        for(auto& [i, v] : updates)
+            tree.update(i, v);
+    });
+    c2 += tree.all();
+
+    auto mops = [&](double ms){ return ops / ms / 1000; };
+    cout<<"recursive : build "<<tBuild1<<" ms, query "<<mops(tQuery1)<<" M/s, update "<<mops(tUpdate1)<<" M/s, "
+        <<"memory "<<(st.size() * sizeof(int)) / (1 << 20)<<" MB"<<endl;
+    cout<<"bottom up : build "<<tBuild2<<" ms, query "<<mops(tQuery2)<<" M/s, update "<<mops(tUpdate2)<<" M/s, "
+        <<"memory "<<(2LL * n * sizeof(int)) / (1 << 20)<<" MB"<<endl;
+    cout<<(c1 == c2 ? "checksums match" : "MISMATCH")<<endl;
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+// Benchmark : SegmentTree memory layouts (ImplicitLayout vs BlockedLayout<H>) on GSS3 max subarray nodes
+// Usage : ./SegmentTree_Layout_Benchmark [n] [ops]     (default n = 10^7, ops = 10^7)
+// Linux only for the counters : they are read with perf_event_open (same events as perf stat),
+// if the kernel doesn't allow it (perf_event_paranoid, containers) they are printed as n/a.
+
+// Same GSS3 workload for every layout : half point updates, half max subarray queries on random ranges.
+// Node and combine are the ones of GSS3 - Can you answer these queries III.cpp.
+
+#include<bits/stdc++.h>
+#include<linux/perf_event.h>
+#include<sys/ioctl.h>
+#include<sys/syscall.h>
+#include<unistd.h>
+using namespace std;
+
+#include "SegmentTree_Template"
+
+#define INF 1000000000
+
+struct node
+{
+    long long sum;
+    long long maxlsum;
+    long long maxrsum;
+    long long maxisum;
+};
+
+struct GSSMonoid{
+    using T = node;
+    static T identity(){ return {0, -INF, -INF, -INF}; }
+    static T combine(const T& a, const T& b){
+        return {a.sum + b.sum,
+                max(a.maxlsum, a.sum + b.maxlsum),
+                max(a.maxrsum + b.sum, b.maxrsum),
+                max(max(a.maxisum, b.maxisum), a.maxrsum + b.maxlsum)};
+    }
+};
+
+class PerfCounter{
+private:
+    int fd;
+public:
+    PerfCounter(uint32_t type, uint64_t config){
+        perf_event_attr pe;
+        memset(&pe, 0, sizeof(pe));
+        pe.type = type;
+        pe.size = sizeof(pe);
+        pe.config = config;
+        pe.disabled = 1;
+        pe.exclude_kernel = 1;
+        pe.exclude_hv = 1;
+        fd = syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
+    }
+
+    // owns fd : only moved, the moved-from counter closes nothing
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+
+    PerfCounter(PerfCounter&& other) : fd(other.fd){
+        other.fd = -1;
+    }
+
+    PerfCounter& operator=(PerfCounter&& other){
+        if(this != &other){
+            if(fd >= 0)
+                close(fd);
+            fd = other.fd;
+            other.fd = -1;
+        }
+        return *this;
+    }
+
+    ~PerfCounter(){
+        if(fd >= 0)
+            close(fd);
+    }
+
+    void start(){
+        if(fd >= 0){
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    void stop(){
+        if(fd >= 0)
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+
+    string value() const{
+        long long count;
+        if(fd < 0 || read(fd, &count, sizeof(count)) != sizeof(count))
+            return "n/a";
+        return to_string(count);
+    }
+};
+
+struct Op{
+    bool isUpdate;
+    int a, b;
+};
+
+template<typename Layout>
+void run(const char* name, const vector<node>& leaves, const vector<Op>& ops){
+    SegmentTree<GSSMonoid, Layout> tree(leaves);
+
+    vector<pair<const char*, PerfCounter>> counters;
+    counters.reserve(5);
+    counters.emplace_back("cycles", PerfCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES));
+    counters.emplace_back("instructions", PerfCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS));
+    counters.emplace_back("cache-references", PerfCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES));
+    counters.emplace_back("cache-misses", PerfCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES));
+    counters.emplace_back("L1-dcache-load-misses", PerfCounter(PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)));
+
+    long long checksum = 0;
+    for(auto& c : counters)
+        c.second.start();
+    auto start = chrono::steady_clock::now();
+    for(auto& op : ops){
+        if(op.isUpdate)
+            tree.update(op.a, {op.b, op.b, op.b, op.b});
+        else
+            checksum += tree.query(op.a, op.b).maxisum;
+    }
+    auto end = chrono::steady_clock::now();
+    for(auto& c : counters)
+        c.second.stop();
+
+    double ms = chrono::duration<double, milli>(end - start).count();
+    cout<<name<<" : "<<ms / ops.size() * 1e6<<" ns/op, memory "<<tree.memoryBytes() / (1 << 20)<<" MB, checksum "<<checksum<<endl;
+    for(auto& c : counters)
+        cout<<"    "<<setw(22)<<left<<c.first<<right<<c.second.value()<<endl;
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    int q = argc > 2 ? atoi(argv[2]) : 10000000;
+
+    mt19937 rng(12345);
+    vector<node> leaves(n);
+    for(auto& x : leaves){
+        int v = int(rng() % 20001) - 10000;
+        x = {v, v, v, v};
+    }
+
+    vector<Op> ops(q);
+    for(auto& op : ops){
+        op.isUpdate = rng() & 1;
+        if(op.isUpdate)
+            op.a = rng() % n, op.b = int(rng() % 20001) - 10000;
+        else{
+            op.a = rng() % n, op.b = rng() % n;
+            if(op.a > op.b)
+                swap(op.a, op.b);
+        }
+    }
+
+    cout<<"n = "<<n<<", ops = "<<q<<", node = "<<sizeof(node)<<" bytes"<<endl;
+    run<ImplicitLayout>("implicit (Eytzinger)", leaves, ops);
+    run<BlockedLayout<2>>("blocked H = 2       ", leaves, ops);
+    run<BlockedLayout<3>>("blocked H = 3       ", leaves, ops);
+    run<BlockedLayout<4>>("blocked H = 4       ", leaves, ops);
+
+    return 0;
+}
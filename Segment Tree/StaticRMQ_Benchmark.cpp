@@ -0,0 +1,102 @@
+// Benchmark : StaticRMQ (StaticRMQ_Template) vs the recursive segment tree of RMQSQ - Range Minimum Query.cpp
+// Usage : ./StaticRMQ_Benchmark [n] [q]     (default n = 10^6, q = 10^7)
+
+// All three answer the same random range minimum queries, the checksums must match.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "StaticRMQ_Template"
+
+#define INF 1000000000
+
+vector<int> ar, st;
+
+void build(int si, int ss, int se){
+	if(ss==se){
+		st[si]=ar[ss];
+		return;
+	}
+
+	int mid = ss + (se-ss)/2;
+
+	build(2*si, ss, mid);
+	build(2*si+1,mid+1, se);
+
+	st[si]= min(st[2*si],st[2*si+1]);
+}
+
+int query(int si, int ss, int se, int qs, int qe){
+
+	if(qe<ss || qs>se)
+		return INF;
+
+	if(ss>=qs && se<=qe)
+		return st[si];
+
+	int mid = ss + (se-ss)/2;
+
+	int left = query(2*si, ss, mid, qs, qe);
+	int right = query(2*si+1, mid+1, se, qs, qe);
+
+	return min(left , right) ;
+}
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int q = argc > 2 ? atoi(argv[2]) : 10000000;
+
+    mt19937 rng(12345);
+    vector<int> input(n);
+    for(int& x : input)
+        x = rng() % INF;
+
+    vector<pair<int,int>> queries(q);
+    for(auto& [l, r] : queries){
+        l = rng() % n, r = rng() % n;
+        if(l > r)
+            swap(l, r);
+    }
+
+    cout<<"n = "<<n<<", q = "<<q<<endl;
+
+    long long c1 = 0;
+    ar.assign(n + 1, 0);
+    st.assign(4 * (n + 1), 0);
+    copy(input.begin(), input.end(), ar.begin() + 1);
+    double tBuild1 = timeIt([&]{ build(1, 1, n); });
+    double tQuery1 = timeIt([&]{
+        for(auto& [l, r] : queries)
+            c1 += query(1, 1, n, l + 1, r + 1);
+    });
+    cout<<"segment tree : build "<<tBuild1<<" ms, "<<tQuery1 / q * 1e6<<" ns/query, memory "
+        <<st.size() * sizeof(int) / (1 << 20)<<" MB"<<endl;
+
+    auto run = [&](auto& rmq, const char* name, double tBuild){
+        long long c = 0;
+        double tQuery = timeIt([&]{
+            for(auto& [l, r] : queries)
+                c += rmq.query(l, r);
+        });
+        cout<<name<<" : build "<<tBuild<<" ms, "<<tQuery / q * 1e6<<" ns/query, memory "
+            <<rmq.memoryBytes() / (1 << 20)<<" MB"<<(c == c1 ? "" : "  (MISMATCH)")<<endl;
+    };
+
+    StaticRMQ<int, SparseTable> sparse;
+    double tBuild2 = timeIt([&]{ sparse = StaticRMQ<int, SparseTable>(input); });
+    run(sparse, "sparse table", tBuild2);
+
+    StaticRMQ<int, BlockRMQ> block;
+    double tBuild3 = timeIt([&]{ block = StaticRMQ<int, BlockRMQ>(input); });
+    run(block, "block rmq   ", tBuild3);
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Benchmark : WaveletMatrix (WaveletMatrix_Template) vs the merge sort tree of KQUERY-K-query.cpp
+// Usage : ./WaveletMatrix_Benchmark [n] [q]     (default n = 10^6, q = 10^6)
+
+// Both answer the same "count of elements < K in [L, R]" queries, the checksums must match.
+// Merge sort tree side is build/query of Intoduction-to-Merge-Sort-Tree, only with vectors so n is chosen at runtime.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "WaveletMatrix_Template"
+
+#define pb push_back
+#define vi vector<int>
+
+vector<vi> st;
+vector<int> ar;
+
+void build(int si, int ss, int se){
+    if(ss==se){
+        st[si].pb(ar[ss]);
+        return;
+    }
+
+    int mid = (se-ss)/2 + ss;
+
+    build(2*si, ss, mid);
+    build(2*si+1, mid+1, se);
+
+    merge(st[2*si].begin(), st[2*si].end(), st[2*si+1].begin(), st[2*si+1].end(), back_inserter(st[si]));
+}
+
+int query(int si, int ss, int se, int qs, int qe, int k){
+    if(ss>qe || se<qs)
+        return 0;
+
+    if(ss>=qs && se<=qe){
+        int res = upper_bound(st[si].begin(), st[si].end(), k-1) - st[si].begin();
+        return res;
+    }
+
+    int mid = (ss+se)/2;
+    int l = query(2*si, ss, mid, qs, qe, k);
+    int r = query(2*si+1, mid+1, se, qs, qe,k);
+
+    return l+r;
+}
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int q = argc > 2 ? atoi(argv[2]) : 1000000;
+
+    mt19937 rng(12345);
+    vector<int> input(n);
+    for(int& x : input)
+        x = rng() % 1000000000 + 1;
+
+    vector<array<int,3>> queries(q);
+    for(auto& [l, r, k] : queries){
+        l = rng() % n, r = rng() % n;
+        if(l > r)
+            swap(l, r);
+        k = rng() % 1000000000 + 1;
+    }
+
+    cout<<"n = "<<n<<", q = "<<q<<endl;
+
+    long long c1 = 0;
+    ar.assign(n + 1, 0);
+    st.assign(4 * (n + 1), vi());
+    copy(input.begin(), input.end(), ar.begin() + 1);
+    double tBuild1 = timeIt([&]{ build(1, 1, n); });
+    double tQuery1 = timeIt([&]{
+        for(auto& [l, r, k] : queries)
+            c1 += query(1, 1, n, l + 1, r + 1, k);
+    });
+    size_t mem1 = st.size() * sizeof(vi);
+    for(auto& v : st)
+        mem1 += v.capacity() * sizeof(int);
+    st.clear();
+    st.shrink_to_fit();
+
+    long long c2 = 0;
+    unique_ptr<WaveletMatrix<uint32_t>> wm;
+    double tBuild2 = timeIt([&]{ wm.reset(new WaveletMatrix<uint32_t>(vector<uint32_t>(input.begin(), input.end()))); });
+    double tQuery2 = timeIt([&]{
+        for(auto& [l, r, k] : queries)
+            c2 += wm->countLess(l, r, k);
+    });
+    size_t mem2 = wm->memoryBytes();
+
+    cout<<"merge sort tree : build "<<tBuild1<<" ms, queries "<<tQuery1<<" ms, memory "<<mem1 / (1 << 20)<<" MB"<<endl;
+    cout<<"wavelet matrix  : build "<<tBuild2<<" ms, queries "<<tQuery2<<" ms, memory "<<mem2 / (1 << 20)<<" MB"<<endl;
+    cout<<(c1 == c2 ? "checksums match" : "MISMATCH")<<endl;
+
+    // the operations the merge sort tree can't do in O(log sigma)
+    long long c3 = 0;
+    double tKth = timeIt([&]{
+        for(auto& [l, r, k] : queries)
+            c3 += wm->kthSmallest(l, r, (r - l) / 2);
+    });
+    double tFreq = timeIt([&]{
+        for(auto& [l, r, k] : queries)
+            c3 += wm->rangeFreq(l, r, k / 2, k);
+    });
+    cout<<"wavelet matrix  : range median "<<tKth<<" ms, range frequency "<<tFreq<<" ms (checksum "<<c3<<")"<<endl;
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+// Benchmark : WideSumTree / WideMinTree (WideSegmentTree_Template) vs the binary SegmentTree<Monoid> (SegmentTree_Template)
+// Usage : ./WideSegmentTree_Benchmark [n] [ops]     (default n = 10^7, ops = 10^7)
+// Build : g++ -O2 -mavx2 WideSegmentTree_Benchmark.cpp      (drop -mavx2 to time the scalar fallback)
+
+// Same workloads as segment-tree-point-update.cpp / RMQSQ - Range Minimum Query.cpp on 32-bit keys :
+// random prefix sums, range sums, range mins, and point updates. Sums wrap in 32 bits on both sides,
+// the checksums must match.
+
+#include<bits/stdc++.h>
+using namespace std;
+
+#include "SegmentTree_Template"
+#include "WideSegmentTree_Template"
+
+#define INF 1000000000
+
+template<typename F>
+double timeIt(F f){
+    auto start = chrono::steady_clock::now();
+    f();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    int ops = argc > 2 ? atoi(argv[2]) : 10000000;
+
+    mt19937 rng(12345);
+    vector<uint32_t> input(n);
+    for(auto& x : input)
+        x = rng() % INF;
+
+    vector<pair<int,int>> queries(ops), updates(ops);
+    for(auto& [l, r] : queries){
+        l = rng() % n, r = rng() % n;
+        if(l > r)
+            swap(l, r);
+    }
+    for(auto& [i, v] : updates)
+        i = rng() % n, v = rng() % INF;
+
+#ifdef __AVX2__
+    cout<<"n = "<<n<<", ops = "<<ops<<", AVX2"<<endl;
+#else
+    cout<<"n = "<<n<<", ops = "<<ops<<", scalar fallback"<<endl;
+#endif
+    auto ns = [&](double ms){ return ms * 1e6 / ops; };
+
+    // prefix sums and range sums, point add
+    {
+        SegmentTree<SumMonoid<uint32_t>> binary(input);
+        WideSumTree<uint32_t> wide(input);
+        uint32_t c1 = 0, c2 = 0, p1 = 0, p2 = 0;
+        double tPrefix1 = timeIt([&]{ for(auto& q : queries) p1 += binary.query(0, q.second); });
+        double tPrefix2 = timeIt([&]{ for(auto& q : queries) p2 += wide.prefix(q.second); });
+        double tQuery1 = timeIt([&]{ for(auto& [l, r] : queries) c1 += binary.query(l, r); });
+        double tQuery2 = timeIt([&]{ for(auto& [l, r] : queries) c2 += wide.query(l, r); });
+        vector<uint32_t> cur = input;
+        double tUpdate1 = timeIt([&]{ for(auto& [i, v] : updates) binary.update(i, v); });
+        double tUpdate2 = timeIt([&]{
+            for(auto& [i, v] : updates){
+                wide.add(i, v - cur[i]);
+                cur[i] = v;
+            }
+        });
+        c1 += binary.all(), c2 += wide.prefix(n - 1);
+
+        cout<<"sum  binary : prefix "<<ns(tPrefix1)<<" ns, range "<<ns(tQuery1)<<" ns, update "<<ns(tUpdate1)<<" ns, "
+            <<"memory "<<(2LL * n * sizeof(uint32_t)) / (1 << 20)<<" MB"<<endl;
+        cout<<"sum  wide   : prefix "<<ns(tPrefix2)<<" ns, range "<<ns(tQuery2)<<" ns, update "<<ns(tUpdate2)<<" ns, "
+            <<"memory "<<wide.memoryBytes() / (1 << 20)<<" MB"<<endl;
+        cout<<(c1 == c2 && p1 == p2 ? "checksums match" : "MISMATCH")<<endl;
+    }
+
+    // range min, point assign
+    {
+        vector<int> keys(input.begin(), input.end());
+        SegmentTree<MinMonoid<int>> binary(keys);
+        WideMinTree<int> wide(keys);
+        long long c1 = 0, c2 = 0;
+        double tQuery1 = timeIt([&]{ for(auto& [l, r] : queries) c1 += binary.query(l, r); });
+        double tQuery2 = timeIt([&]{ for(auto& [l, r] : queries) c2 += wide.query(l, r); });
+        double tUpdate1 = timeIt([&]{ for(auto& [i, v] : updates) binary.update(i, v); });
+        double tUpdate2 = timeIt([&]{ for(auto& [i, v] : updates) wide.update(i, v); });
+        c1 += binary.all(), c2 += wide.query(0, n - 1);
+
+        cout<<"min  binary : range "<<ns(tQuery1)<<" ns, update "<<ns(tUpdate1)<<" ns, "
+            <<"memory "<<(2LL * n * sizeof(int)) / (1 << 20)<<" MB"<<endl;
+        cout<<"min  wide   : range "<<ns(tQuery2)<<" ns, update "<<ns(tUpdate2)<<" ns, "
+            <<"memory "<<wide.memoryBytes() / (1 << 20)<<" MB"<<endl;
+        cout<<(c1 == c2 ? "checksums match" : "MISMATCH")<<endl;
+    }
+
+    return 0;
+}